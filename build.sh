@@ -11,7 +11,7 @@ Usage()
 }
 
 # Initialise the options
-OPTS=$(getopt -o dh --long debug,help -n "$(basename "$0")" -- "$@")
+OPTS=$(getopt -o dsh --long debug,surfaceless,help -n "$(basename "$0")" -- "$@")
 if [ $? != 0 ]; then echo; Usage; fi
 eval set -- "$OPTS"
 
@@ -25,6 +25,11 @@ if [[ $* > 1 ]] ; then
         shift
         ;;
 
+      -s|--surfaceless ) # The tests render without a display server by default, for a headless adaptor
+        SURFACELESS_BUILD="-DSURFACELESS=ON"
+        shift
+        ;;
+
       -h|--help ) # Help
         shift
         Usage
@@ -42,6 +47,6 @@ if [[ $* > 1 ]] ; then
   done
 fi
 
-command="( cd build/tizen ; cmake -DCMAKE_INSTALL_PREFIX=$DESKTOP_PREFIX ${DEBUG_BUILD} . ; make install -j8 )"
+command="( cd build/tizen ; cmake -DCMAKE_INSTALL_PREFIX=$DESKTOP_PREFIX ${DEBUG_BUILD} ${SURFACELESS_BUILD} . ; make install -j8 )"
 echo $command
 eval $command
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "allocation-counter.h"
+
+// EXTERNAL INCLUDES
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+// A plain integer, the replacement of operator new must not allocate itself
+thread_local uint64_t gThreadAllocations = 0u;
+
+void* Allocate(std::size_t size)
+{
+  ++gThreadAllocations;
+
+  void* pointer = nullptr;
+  while(!(pointer = malloc(size ? size : 1u)))
+  {
+    std::new_handler handler = std::get_new_handler();
+    if(!handler)
+    {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+  return pointer;
+}
+
+void* AllocateNoThrow(std::size_t size) noexcept
+{
+  try
+  {
+    return Allocate(size);
+  }
+  catch(...)
+  {
+    return nullptr;
+  }
+}
+} // namespace
+
+uint64_t GetThreadAllocationCount()
+{
+  return gThreadAllocations;
+}
+
+void* operator new(std::size_t size)
+{
+  return Allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return Allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return AllocateNoThrow(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return AllocateNoThrow(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+  free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+  free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /* not used */) noexcept
+{
+  free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t /* not used */) noexcept
+{
+  free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+  free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+  free(pointer);
+}
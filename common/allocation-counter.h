@@ -0,0 +1,35 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+/**
+ * @brief Get the number of allocations made with operator new by the calling
+ * thread since it started.
+ *
+ * The harness replaces the global operator new, so the allocations of DALi
+ * are counted too. The count is per thread, so that the allocations of the
+ * update and render threads do not add to those of the code measured on the
+ * event thread. The allocations made with malloc directly are not counted.
+ */
+uint64_t GetThreadAllocationCount();
+
+#endif // ALLOCATION_COUNTER_H
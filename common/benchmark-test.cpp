@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "benchmark-test.h"
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/window-devel.h>
+#include <cstdio>
+#include <memory>
+
+void BenchmarkTest::Finish(Dali::Application& application)
+{
+  if(!HasFailure())
+  {
+    gExitValue = 0;
+  }
+  application.Quit();
+}
+
+std::vector<int> BenchmarkTest::GetInstanceCounts(std::vector<int> defaultCounts, int maxCount)
+{
+  if(gInstanceCount == 0)
+  {
+    return defaultCounts;
+  }
+  if(gInstanceCount > maxCount)
+  {
+    fprintf(stderr, "--instances must be from 1 to %d for %s\n", maxCount, gTestName);
+    return {};
+  }
+  return {gInstanceCount};
+}
+
+void BenchmarkTest::StartFirstFrameTimer()
+{
+  mFirstFrameStart = std::chrono::steady_clock::now();
+  mFirstFrameMs    = -1.0;
+}
+
+void BenchmarkTest::TimeFirstFrame(Dali::Window window)
+{
+  // A frame asked for by an earlier load is ignored
+  Dali::DevelWindow::AddFramePresentedCallback(window, std::unique_ptr<Dali::CallbackBase>(Dali::MakeCallback(this, &BenchmarkTest::OnFramePresented)), ++mFirstFrameId);
+}
+
+void BenchmarkTest::OnFramePresented(int32_t frameId)
+{
+  if(frameId == mFirstFrameId && mFirstFrameMs < 0.0)
+  {
+    mFirstFrameMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mFirstFrameStart).count();
+  }
+}
+
+void BenchmarkTest::PostRender(std::string outputFile, bool writeSuccess)
+{
+}
@@ -0,0 +1,140 @@
+#ifndef BENCHMARK_TEST_H
+#define BENCHMARK_TEST_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <dali/dali.h>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "perf-statistics.h"
+#include "visual-test.h"
+
+/**
+ * @brief The base of the benchmarks, the tests which report measures (see
+ * VisualTest::ReportMetric) rather than compare captures of the window.
+ *
+ * A benchmark fails the step whose measure cannot be taken with FailStep, and
+ * passes unless one of its steps has failed.
+ *
+ * The benchmarks which load something time the first frame presented with it:
+ *
+ * @code
+ * mSequencer.AddStep("load")
+ *     .Do([this]() {
+ *       StartFirstFrameTimer();
+ *       Load();
+ *       TimeFirstFrame(mApplication.GetWindow());
+ *     })
+ *     .WaitForFrames(FIRST_FRAME_WAIT)
+ *     .Then([this]() { mLoad.firstFrameMs = GetFirstFrameMs(); });
+ * mSequencer.SetFinishedCallback([this]() { Finish(mApplication); });
+ * @endcode
+ */
+class BenchmarkTest : public VisualTest {
+protected:
+  /**
+   * @brief Pass the test unless one of its steps has failed, and quit.
+   * @param[in] application The application of the test
+   */
+  void Finish(Dali::Application &application);
+
+  /**
+   * @brief Get the numbers of instances measured by a benchmark, one step
+   * each.
+   * @param[in] defaultCounts The numbers measured unless the test is run with
+   * --instances N
+   * @param[in] maxCount The largest number of instances of the benchmark
+   * @return {N} with --instances N, else defaultCounts, or none after an
+   * error if N is above maxCount
+   */
+  static std::vector<int> GetInstanceCounts(std::vector<int> defaultCounts,
+                                            int maxCount);
+
+  /**
+   * @brief Start the time to the first frame, before a load.
+   */
+  void StartFirstFrameTimer();
+
+  /**
+   * @brief Ask for the time at which the next frame is presented, once the
+   * load has changed the scene.
+   * @param[in] window The window presenting the frame
+   */
+  void TimeFirstFrame(Dali::Window window);
+
+  /**
+   * @brief Get the time to the first frame of the last load.
+   * @return The time from StartFirstFrameTimer to the presentation of the
+   * frame in milliseconds, or -1 if it has not been presented yet
+   */
+  double GetFirstFrameMs() const { return mFirstFrameMs; }
+
+  /**
+   * @brief Report the median of a measure of some samples, e.g. of the loads.
+   * @param[in] name The name of the metric
+   * @param[in] unit The unit of the measure, e.g. "ms"
+   * @param[in] samples The samples
+   * @param[in] measure Gives the measure of a sample as a double
+   */
+  template <typename Sample, typename Measure>
+  void ReportMedian(const std::string &name, const std::string &unit,
+                    const std::vector<Sample> &samples, Measure measure) {
+    std::vector<double> values;
+    for (const Sample &sample : samples) {
+      values.push_back(measure(sample));
+    }
+    ReportMetric(name, ComputeStatistics(values).median, unit);
+  }
+
+private:
+  void OnFramePresented(int32_t frameId);
+
+  /**
+   * @brief A benchmark does not capture the window, so this is never called.
+   */
+  void PostRender(std::string outputFile, bool writeSuccess) override;
+
+  std::chrono::steady_clock::time_point mFirstFrameStart;
+  int32_t mFirstFrameId = 0;    ///< The frame of the last TimeFirstFrame
+  double mFirstFrameMs = -1.0; ///< -1 until the frame is presented
+};
+
+/**
+ * DALI_BENCHMARK_TEST creates the main function of a benchmark, as
+ * DALI_VISUAL_TEST_WITH_STEPS does, and flags it in its metadata so that
+ * execute.sh only runs it with --benchmarks or when it is named by --test.
+ * @param[in] BenchmarkName The class name of the benchmark
+ * @param[in] InitFunction The name of the callback function to connect with the
+ * application's InitSignal
+ * @param[in] WindowWidth The width of the application's main window
+ * @param[in] WindowHeight The height of the application's main window
+ * @param[in] StepCount The number of steps of the benchmark, or 0 if not known
+ * @param[in] StepTimeout The default deadline of a step in milliseconds
+ */
+#define DALI_BENCHMARK_TEST(BenchmarkName, InitFunction, WindowWidth,          \
+                            WindowHeight, StepCount, StepTimeout)              \
+  DALI_VISUAL_TEST_METADATA(BenchmarkName, WindowWidth, WindowHeight,          \
+                            StepCount, StepTimeout,                            \
+                            TEST_METADATA_FLAG_BENCHMARK)                      \
+  DALI_VISUAL_TEST_MAIN(BenchmarkName, InitFunction, WindowWidth, WindowHeight)
+
+#endif // BENCHMARK_TEST_H
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "frame-cost-probe.h"
+
+// EXTERNAL INCLUDES
+#include <time.h>
+
+namespace
+{
+int64_t GetClockUs(clockid_t clock)
+{
+  timespec time;
+  clock_gettime(clock, &time);
+  return static_cast<int64_t>(time.tv_sec) * 1000000 + time.tv_nsec / 1000;
+}
+} // namespace
+
+void FrameCostProbe::Start(uint32_t skippedFrames, bool keepRendering)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mInterval      = FrameHistogram();
+  mCpu           = FrameHistogram();
+  mSkipped       = skippedFrames;
+  mRecording     = true;
+  mKeepRendering = keepRendering;
+}
+
+void FrameCostProbe::Stop()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mRecording = false;
+}
+
+FrameTimeSummary FrameCostProbe::GetIntervals() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mInterval.Summarize();
+}
+
+FrameTimeSummary FrameCostProbe::GetCpuTimes() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mCpu.Summarize();
+}
+
+bool FrameCostProbe::Update(Dali::UpdateProxy& updateProxy, float elapsedSeconds)
+{
+  const int64_t now = GetClockUs(CLOCK_MONOTONIC);
+  const int64_t cpu = GetClockUs(CLOCK_THREAD_CPUTIME_ID);
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  if(mRecording)
+  {
+    if(mSkipped > 0u)
+    {
+      --mSkipped;
+    }
+    else if(mLastTime > 0)
+    {
+      mInterval.Record(static_cast<uint64_t>(now - mLastTime));
+      mCpu.Record(static_cast<uint64_t>(cpu - mLastCpu));
+    }
+  }
+  mLastTime = now;
+  mLastCpu  = cpu;
+
+  // Otherwise the update thread only runs while something changes, e.g. an animation
+  return mRecording && mKeepRendering;
+}
@@ -0,0 +1,71 @@
+#ifndef FRAME_COST_PROBE_H
+#define FRAME_COST_PROBE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/update/frame-callback-interface.h>
+#include <cstdint>
+#include <mutex>
+
+// INTERNAL INCLUDES
+#include "frame-histogram.h"
+
+/**
+ * @brief Records the cost of the frames on the update thread: the interval
+ * between two frames, and the CPU time of the thread in between.
+ *
+ * DALi updates and renders each frame on the same thread, the CPU time of a
+ * frame is that of both; the interval includes the wait for the vsync and
+ * for the GPU. It is added with DevelStage::AddFrameCallback.
+ */
+class FrameCostProbe : public Dali::FrameCallbackInterface {
+public:
+  /**
+   * @brief Start recording, after the given number of frames.
+   * @param[in] skippedFrames The frames not recorded, e.g. while the
+   * resources are uploaded
+   * @param[in] keepRendering Whether the probe asks for the next frame while
+   * it records, for scenes which do not change by themselves
+   */
+  void Start(uint32_t skippedFrames, bool keepRendering = false);
+
+  /**
+   * @brief Stop recording.
+   */
+  void Stop();
+
+  FrameTimeSummary GetIntervals() const;
+
+  FrameTimeSummary GetCpuTimes() const;
+
+private:
+  bool Update(Dali::UpdateProxy &updateProxy, float elapsedSeconds) override;
+
+private:
+  mutable std::mutex mMutex;
+  FrameHistogram mInterval;
+  FrameHistogram mCpu;
+  uint32_t mSkipped = 0u;
+  bool mRecording = false;
+  bool mKeepRendering = false;
+  int64_t mLastTime = 0; ///< 0 before the first frame
+  int64_t mLastCpu = 0;
+};
+
+#endif // FRAME_COST_PROBE_H
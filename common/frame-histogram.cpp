@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "frame-histogram.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// The values below SUB_BUCKET_COUNT have a bucket each, every further power of two is split into HALF_SUB_BUCKET_COUNT buckets
+constexpr uint64_t SUB_BUCKET_COUNT      = 1u << FRAME_HISTOGRAM_PRECISION_BITS;
+constexpr uint64_t HALF_SUB_BUCKET_COUNT = SUB_BUCKET_COUNT / 2u;
+constexpr uint64_t HIGHEST_VALUE         = (uint64_t(1u) << FRAME_HISTOGRAM_MAX_BITS) - 1u;
+constexpr size_t   BUCKET_COUNT          = SUB_BUCKET_COUNT + (FRAME_HISTOGRAM_MAX_BITS - FRAME_HISTOGRAM_PRECISION_BITS) * HALF_SUB_BUCKET_COUNT;
+
+double ToMilliseconds(uint64_t valueUs)
+{
+  return static_cast<double>(valueUs) / 1000.0;
+}
+} // namespace
+
+FrameHistogram::FrameHistogram()
+: mCounts(BUCKET_COUNT, 0u),
+  mCount(0u),
+  mMax(0u)
+{
+}
+
+void FrameHistogram::Record(uint64_t valueUs)
+{
+  ++mCounts[GetIndex(std::min(valueUs, HIGHEST_VALUE))];
+  ++mCount;
+  mMax = std::max(mMax, valueUs);
+}
+
+uint64_t FrameHistogram::GetCount() const
+{
+  return mCount;
+}
+
+uint64_t FrameHistogram::GetMax() const
+{
+  return mMax;
+}
+
+uint64_t FrameHistogram::GetPercentile(double percentile) const
+{
+  if(mCount == 0u)
+  {
+    return 0u;
+  }
+
+  // The rank of the value, from 1 to the count
+  const double   fraction = std::min(100.0, std::max(0.0, percentile)) / 100.0;
+  const uint64_t rank     = std::max<uint64_t>(1u, static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(mCount))));
+
+  uint64_t total = 0u;
+  for(size_t index = 0u; index < mCounts.size(); ++index)
+  {
+    total += mCounts[index];
+    if(total >= rank)
+    {
+      // The bucket may reach further than any value recorded, and the last one holds all the larger values
+      return (index + 1u == mCounts.size()) ? mMax : std::min(GetHighestValue(index), mMax);
+    }
+  }
+  return mMax;
+}
+
+FrameTimeSummary FrameHistogram::Summarize() const
+{
+  FrameTimeSummary summary;
+  summary.count = mCount;
+  summary.p50Ms = ToMilliseconds(GetPercentile(50.0));
+  summary.p90Ms = ToMilliseconds(GetPercentile(90.0));
+  summary.p99Ms = ToMilliseconds(GetPercentile(99.0));
+  summary.maxMs = ToMilliseconds(mMax);
+  return summary;
+}
+
+size_t FrameHistogram::GetIndex(uint64_t value)
+{
+  if(value < SUB_BUCKET_COUNT)
+  {
+    return static_cast<size_t>(value);
+  }
+
+  // The bits below the precision are dropped, one more for every power of two
+  const unsigned int highestBit = 63u - static_cast<unsigned int>(__builtin_clzll(value));
+  const unsigned int shift      = highestBit - FRAME_HISTOGRAM_PRECISION_BITS + 1u;
+  const uint64_t     subBucket  = value >> shift; // From HALF_SUB_BUCKET_COUNT to SUB_BUCKET_COUNT - 1
+  return static_cast<size_t>(SUB_BUCKET_COUNT + (shift - 1u) * HALF_SUB_BUCKET_COUNT + (subBucket - HALF_SUB_BUCKET_COUNT));
+}
+
+uint64_t FrameHistogram::GetHighestValue(size_t index)
+{
+  if(index < SUB_BUCKET_COUNT)
+  {
+    return index;
+  }
+
+  const uint64_t shift     = (index - SUB_BUCKET_COUNT) / HALF_SUB_BUCKET_COUNT + 1u;
+  const uint64_t subBucket = (index - SUB_BUCKET_COUNT) % HALF_SUB_BUCKET_COUNT + HALF_SUB_BUCKET_COUNT;
+  return ((subBucket + 1u) << shift) - 1u;
+}
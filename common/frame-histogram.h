@@ -0,0 +1,104 @@
+#ifndef FRAME_HISTOGRAM_H
+#define FRAME_HISTOGRAM_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// The number of bits of the values kept exactly, the others are rounded up:
+// 7 bits keep every recorded value within 1/64 (1.6%) of its true value
+#define FRAME_HISTOGRAM_PRECISION_BITS 7u
+
+// The highest value recorded in microseconds (about 19 hours), larger values
+// are counted in the last bucket
+#define FRAME_HISTOGRAM_MAX_BITS 36u
+
+/**
+ * @brief The percentiles of the frame times of a histogram, in milliseconds.
+ */
+struct FrameTimeSummary {
+  uint64_t count = 0u; ///< The number of values recorded
+  double p50Ms = 0.0;  ///< The median
+  double p90Ms = 0.0;  ///< The 90th percentile
+  double p99Ms = 0.0;  ///< The 99th percentile
+  double maxMs = 0.0;  ///< The largest value, exact
+};
+
+/**
+ * @brief A histogram of frame times in the manner of HdrHistogram.
+ *
+ * The values are counted in buckets whose width grows with the value, so that
+ * the relative error of every value is bounded (see
+ * FRAME_HISTOGRAM_PRECISION_BITS) and a whole test run of frames fits in a few
+ * kilobytes, however long the run and whatever the outliers. Recording is
+ * constant time and does not allocate.
+ *
+ * The histogram is not thread safe, it is meant to be fed from the event
+ * thread.
+ */
+class FrameHistogram {
+public:
+  /**
+   * @brief Constructor.
+   */
+  FrameHistogram();
+
+  /**
+   * @brief Record a value.
+   * @param[in] valueUs The value in microseconds
+   */
+  void Record(uint64_t valueUs);
+
+  /**
+   * @brief Get the number of values recorded.
+   */
+  uint64_t GetCount() const;
+
+  /**
+   * @brief Get the largest value recorded, exact.
+   */
+  uint64_t GetMax() const;
+
+  /**
+   * @brief Get a percentile of the values recorded.
+   * @param[in] percentile The percentile, from 0 to 100
+   * @return The highest value of the bucket holding the percentile, i.e. never
+   * below the true percentile and within the precision of the histogram, or 0
+   * if nothing has been recorded
+   */
+  uint64_t GetPercentile(double percentile) const;
+
+  /**
+   * @brief Get the percentiles of the values recorded.
+   */
+  FrameTimeSummary Summarize() const;
+
+private:
+  static size_t GetIndex(uint64_t value);
+  static uint64_t GetHighestValue(size_t index);
+
+private:
+  std::vector<uint64_t> mCounts; ///< The number of values of each bucket
+  uint64_t mCount;               ///< The number of values recorded
+  uint64_t mMax;                 ///< The largest value recorded
+};
+
+#endif // FRAME_HISTOGRAM_H
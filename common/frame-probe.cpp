@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "frame-probe.h"
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/window-devel.h>
+#include <dali/devel-api/common/stage-devel.h>
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <chrono>
+#include <memory>
+
+// INTERNAL INCLUDES
+#include "startup-timeline.h"
+
+using namespace Dali;
+
+namespace
+{
+int64_t NowUs()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+FrameProbe::FrameProbe(Dali::Window window, int windowIndex)
+: mWindow(window),
+  mWindowIndex(windowIndex),
+  mAttached(false),
+  mPresentPending(false),
+  mFrameId(0),
+  mEventTime(0),
+  mFrameEventTime(0),
+  mLastUpdateTime(0),
+  mDropped(0u),
+  mIdleGaps(0u)
+{
+}
+
+FrameProbe::~FrameProbe()
+{
+  Detach();
+}
+
+void FrameProbe::Attach()
+{
+  Dali::Window window = mWindow.GetHandle();
+  if(mAttached || !window || !Adaptor::IsAvailable())
+  {
+    return;
+  }
+  mAttached = true;
+
+  // A post processor runs at the end of every event processing, after the messages of the frame have been sent
+  Adaptor::Get().RegisterProcessor(*this, true);
+  DevelStage::AddFrameCallback(Stage::GetCurrent(), *this, window.GetRootLayer());
+  RequestFramePresented();
+}
+
+void FrameProbe::Detach()
+{
+  if(!mAttached)
+  {
+    return;
+  }
+  mAttached = false;
+
+  if(Adaptor::IsAvailable())
+  {
+    Adaptor::Get().UnregisterProcessor(*this, true);
+    DevelStage::RemoveFrameCallback(Stage::GetCurrent(), *this);
+  }
+}
+
+bool FrameProbe::IsProbing(Dali::Window window) const
+{
+  return mWindow.GetHandle() == window;
+}
+
+WindowFrames FrameProbe::GetFrames() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+
+  WindowFrames frames;
+  frames.windowIndex = mWindowIndex;
+  frames.latency     = mLatency.Summarize();
+  frames.interval    = mInterval.Summarize();
+  frames.dropped     = mDropped;
+  frames.idleGaps    = mIdleGaps;
+  return frames;
+}
+
+bool FrameProbe::Update(Dali::UpdateProxy& /* not used */, float /* not used */)
+{
+  MarkStartupPhase(STARTUP_FIRST_UPDATE);
+
+  // The frame being updated carries the events processed so far
+  mFrameEventTime = mEventTime.load();
+
+  // Every update is a frame, whereas the frames presented are only sampled
+  const int64_t now = NowUs();
+  if(mLastUpdateTime > 0)
+  {
+    const uint64_t interval = static_cast<uint64_t>(now - mLastUpdateTime);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if(interval > FRAME_IDLE_THRESHOLD_US)
+    {
+      ++mIdleGaps;
+    }
+    else
+    {
+      mInterval.Record(interval);
+
+      // An interval of N vsync periods, rounded, misses N - 1 frames
+      const uint64_t periods = (interval + FRAME_PERIOD_US / 2u) / FRAME_PERIOD_US;
+      mDropped += periods > 1u ? periods - 1u : 0u;
+    }
+  }
+  mLastUpdateTime = now;
+
+  return false; // The probe never keeps the update thread running
+}
+
+void FrameProbe::Process(bool /* not used */)
+{
+  mEventTime = NowUs();
+
+  // Asked here rather than when the last frame was presented, so that the probe never causes a frame itself
+  if(!mPresentPending)
+  {
+    RequestFramePresented();
+  }
+}
+
+std::string_view FrameProbe::GetProcessorName() const
+{
+  return "FrameProbe";
+}
+
+void FrameProbe::RequestFramePresented()
+{
+  Dali::Window window = mWindow.GetHandle();
+  if(!window)
+  {
+    return;
+  }
+
+  mPresentPending = true;
+  DevelWindow::AddFramePresentedCallback(window, std::unique_ptr<CallbackBase>(MakeCallback(this, &FrameProbe::OnFramePresented)), ++mFrameId);
+}
+
+void FrameProbe::OnFramePresented(int32_t frameId)
+{
+  if(!mAttached || frameId != mFrameId)
+  {
+    return;
+  }
+  mPresentPending = false;
+  MarkStartupPhase(STARTUP_FIRST_FRAME);
+
+  const int64_t now       = NowUs();
+  const int64_t eventTime = mFrameEventTime.load();
+  if(eventTime > 0 && now >= eventTime)
+  {
+    mLatency.Record(static_cast<uint64_t>(now - eventTime));
+  }
+}
@@ -0,0 +1,131 @@
+#ifndef FRAME_PROBE_H
+#define FRAME_PROBE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <cstdint>
+#include <dali/dali.h>
+#include <dali/devel-api/update/frame-callback-interface.h>
+#include <dali/integration-api/processor-interface.h>
+#include <mutex>
+#include <string_view>
+
+// INTERNAL INCLUDES
+#include "frame-histogram.h"
+#include "test-results.h"
+
+// The vsync period in microseconds, an interval of N periods misses N - 1 frames
+#define FRAME_PERIOD_US 16667u
+
+// The interval in microseconds above which the window is considered idle
+// rather than slow, e.g. while a test waits for a resource between two frames
+#define FRAME_IDLE_THRESHOLD_US 250000u
+
+/**
+ * @brief Records the frame times of a window for the whole test run.
+ *
+ * Two measures are kept in a FrameHistogram each:
+ * - the interval between two consecutive frames, from a frame callback on the
+ *   update thread, which is called once per frame;
+ * - the latency from the event processing to the frame presented: the end of
+ *   the last event processing before the update of a frame (a post processor
+ *   of the adaptor, latched by the frame callback) to the frame presented
+ *   callback of the window. It is sampled once per event processing, as the
+ *   animations render frames without any.
+ *
+ * The intervals above FRAME_IDLE_THRESHOLD_US are counted as idle gaps rather
+ * than as frames, the tests render on demand. The others count the vsync
+ * periods they miss as dropped frames.
+ *
+ * The probe neither keeps the update thread running nor requests frames, so
+ * the tests render exactly as they would without it.
+ */
+class FrameProbe : public Dali::FrameCallbackInterface,
+                   public Dali::Integration::Processor {
+public:
+  /**
+   * @brief Constructor.
+   * @param[in] window The window to probe
+   * @param[in] windowIndex The index of the window in the results, from 1
+   */
+  FrameProbe(Dali::Window window, int windowIndex);
+
+  /**
+   * @brief Destructor, the probe must be detached first.
+   */
+  ~FrameProbe() override;
+
+  /**
+   * @brief Start recording the frames of the window.
+   */
+  void Attach();
+
+  /**
+   * @brief Stop recording, e.g. when the application terminates.
+   */
+  void Detach();
+
+  /**
+   * @brief Check whether the probe records the given window.
+   */
+  bool IsProbing(Dali::Window window) const;
+
+  /**
+   * @brief Get the percentiles of the frames recorded so far.
+   */
+  WindowFrames GetFrames() const;
+
+private: // From Dali::FrameCallbackInterface, called on the update thread
+  bool Update(Dali::UpdateProxy &updateProxy, float elapsedSeconds) override;
+
+private: // From Dali::Integration::Processor
+  void Process(bool postProcessor) override;
+  std::string_view GetProcessorName() const override;
+
+private:
+  /**
+   * @brief Ask the window for the presentation of its next frame.
+   */
+  void RequestFramePresented();
+
+  /**
+   * @brief Called on the event thread when a frame has been presented.
+   */
+  void OnFramePresented(int32_t frameId);
+
+private:
+  Dali::WeakHandle<Dali::Window> mWindow;
+  int mWindowIndex;
+  bool mAttached;
+  bool mPresentPending;                 ///< Whether a frame is waited for
+  int32_t mFrameId;                     ///< The id of the frame waited for
+  std::atomic<int64_t> mEventTime;      ///< The end of the last event processing
+  std::atomic<int64_t> mFrameEventTime; ///< mEventTime of the last update
+  FrameHistogram mLatency;              ///< Event to present
+
+  // Updated on the update thread
+  mutable std::mutex mMutex;
+  int64_t mLastUpdateTime;  ///< 0 before the first frame
+  FrameHistogram mInterval; ///< Update to update
+  uint64_t mDropped;
+  uint64_t mIdleGaps;
+};
+
+#endif // FRAME_PROBE_H
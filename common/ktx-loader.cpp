@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "ktx-loader.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+using namespace Dali;
+
+namespace
+{
+const uint8_t KTX_IDENTIFIER[] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+const uint32_t KTX_ENDIANNESS  = 0x04030201; // As written by a little endian machine
+const uint32_t CUBE_FACE_COUNT = 6u;
+
+/**
+ * @brief The header of a KTX 1 file, after its identifier.
+ */
+struct KtxHeader
+{
+  uint32_t endianness;
+  uint32_t glType;
+  uint32_t glTypeSize;
+  uint32_t glFormat;
+  uint32_t glInternalFormat;
+  uint32_t glBaseInternalFormat;
+  uint32_t pixelWidth;
+  uint32_t pixelHeight;
+  uint32_t pixelDepth;
+  uint32_t numberOfArrayElements;
+  uint32_t numberOfFaces;
+  uint32_t numberOfMipmapLevels;
+  uint32_t bytesOfKeyValueData;
+};
+
+/**
+ * @brief The uncompressed formats supported, by their GL type and format.
+ */
+struct KtxFormat
+{
+  uint32_t      glType;
+  uint32_t      glFormat;
+  Pixel::Format format;
+  uint32_t      bytesPerPixel;
+};
+
+const KtxFormat KTX_FORMATS[] = {
+  {0x140B, 0x1907, Pixel::RGB16F, 6u},   // GL_HALF_FLOAT, GL_RGB, as the Scene3D environments
+  {0x1406, 0x1907, Pixel::RGB32F, 12u},  // GL_FLOAT, GL_RGB
+  {0x1401, 0x1907, Pixel::RGB888, 3u},   // GL_UNSIGNED_BYTE, GL_RGB
+  {0x1401, 0x1908, Pixel::RGBA8888, 4u}, // GL_UNSIGNED_BYTE, GL_RGBA
+};
+
+using Clock = std::chrono::steady_clock;
+
+double Milliseconds(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+uint32_t AlignTo4(uint32_t size)
+{
+  return (size + 3u) & ~3u;
+}
+
+/**
+ * @brief Unpack a face of a mip level, whose rows are aligned to 4 bytes, into tightly packed pixel data.
+ */
+PixelData UnpackFace(const uint8_t* face, uint32_t width, uint32_t height, const KtxFormat& format)
+{
+  const uint32_t rowSize    = width * format.bytesPerPixel;
+  const uint32_t rowStride  = AlignTo4(rowSize);
+  const uint32_t bufferSize = rowSize * height;
+
+  uint8_t* buffer = new uint8_t[bufferSize];
+  if(rowSize == rowStride)
+  {
+    memcpy(buffer, face, bufferSize);
+  }
+  else
+  {
+    for(uint32_t row = 0u; row < height; ++row)
+    {
+      memcpy(buffer + row * rowSize, face + row * rowStride, rowSize);
+    }
+  }
+  return PixelData::New(buffer, bufferSize, width, height, format.format, PixelData::DELETE_ARRAY);
+}
+} // namespace
+
+Texture LoadKtxTexture(const std::string& path, KtxProfile* profile)
+{
+  KtxProfile loadProfile;
+
+  Clock::time_point start = Clock::now();
+  std::ifstream     file(path, std::ios::binary);
+  uint8_t           identifier[sizeof(KTX_IDENTIFIER)];
+  KtxHeader         header;
+  if(!file.read(reinterpret_cast<char*>(identifier), sizeof(identifier)) ||
+     memcmp(identifier, KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER)) ||
+     !file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+     header.endianness != KTX_ENDIANNESS)
+  {
+    return Texture();
+  }
+
+  // Neither the compressed formats, nor the arrays and the 3D textures, which the environments are not
+  const KtxFormat* format = std::find_if(std::begin(KTX_FORMATS), std::end(KTX_FORMATS), [&header](const KtxFormat& format) {
+    return format.glType == header.glType && format.glFormat == header.glFormat;
+  });
+  if(format == std::end(KTX_FORMATS) || header.numberOfArrayElements > 0u || header.pixelDepth > 1u ||
+     (header.numberOfFaces != 1u && header.numberOfFaces != CUBE_FACE_COUNT) || header.pixelWidth == 0u ||
+     header.pixelHeight == 0u || !file.seekg(header.bytesOfKeyValueData, std::ios::cur))
+  {
+    return Texture();
+  }
+  loadProfile.headerMs = Milliseconds(start);
+
+  const uint32_t          mipCount = std::max(header.numberOfMipmapLevels, 1u);
+  const TextureType::Type type     = header.numberOfFaces == CUBE_FACE_COUNT ? TextureType::TEXTURE_CUBE : TextureType::TEXTURE_2D;
+  Texture                 texture  = Texture::New(type, format->format, header.pixelWidth, header.pixelHeight);
+
+  std::vector<uint8_t> level;
+  for(uint32_t mip = 0u; mip < mipCount; ++mip)
+  {
+    KtxMipProfile mipProfile;
+    mipProfile.width  = std::max(header.pixelWidth >> mip, 1u);
+    mipProfile.height = std::max(header.pixelHeight >> mip, 1u);
+
+    // The size of a face, each of which is aligned to 4 bytes
+    start = Clock::now();
+    uint32_t imageSize;
+    if(!file.read(reinterpret_cast<char*>(&imageSize), sizeof(imageSize)) ||
+       imageSize < AlignTo4(mipProfile.width * format->bytesPerPixel) * mipProfile.height)
+    {
+      return Texture();
+    }
+    const uint32_t faceSize = AlignTo4(imageSize);
+    level.resize(static_cast<size_t>(faceSize) * header.numberOfFaces);
+    if(!file.read(reinterpret_cast<char*>(level.data()), level.size()))
+    {
+      return Texture();
+    }
+    mipProfile.parseMs = Milliseconds(start);
+
+    start = Clock::now();
+    std::vector<PixelData> faces;
+    for(uint32_t face = 0u; face < header.numberOfFaces; ++face)
+    {
+      faces.push_back(UnpackFace(level.data() + face * faceSize, mipProfile.width, mipProfile.height, *format));
+    }
+    mipProfile.decodeMs = Milliseconds(start);
+
+    for(uint32_t face = 0u; face < header.numberOfFaces; ++face)
+    {
+      texture.Upload(faces[face], face, mip, 0u, 0u, mipProfile.width, mipProfile.height);
+    }
+
+    loadProfile.mips.push_back(mipProfile);
+  }
+
+  if(profile)
+  {
+    *profile = loadProfile;
+  }
+  return texture;
+}
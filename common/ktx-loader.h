@@ -0,0 +1,65 @@
+#ifndef KTX_LOADER_H
+#define KTX_LOADER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/dali.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The cost of the loading of a mip level of a KTX file, for all its
+ * faces.
+ */
+struct KtxMipProfile {
+  uint32_t width = 0u;   ///< The width of the level, in pixels
+  uint32_t height = 0u;  ///< The height of the level, in pixels
+  double parseMs = 0.0;  ///< Reading the level from the file
+  double decodeMs = 0.0; ///< Unpacking its rows into the pixel data
+};
+
+/**
+ * @brief The cost of the loading of a KTX file, mip level by mip level.
+ */
+struct KtxProfile {
+  double headerMs = 0.0; ///< Opening the file and parsing its header
+  std::vector<KtxMipProfile> mips;
+};
+
+/**
+ * @brief Load an uncompressed KTX 1 file, e.g. the Radiance.ktx cube map of
+ * the Scene3D environments, into a texture with all its mip levels.
+ *
+ * This is what Scene3D::Loader does for the environment maps, done by the
+ * harness so that each stage of each level is timed on its own. The rows of
+ * the file are aligned to 4 bytes, they are unpacked into tightly packed pixel
+ * data which is then uploaded. The upload is only queued for the render
+ * thread, it is not timed here: it is done by the first frame after the load.
+ *
+ * It must be called on the event thread.
+ * @param[in] path The path of the KTX file
+ * @param[out] profile The cost of the load, or nullptr
+ * @return The texture, a cube map if the file has 6 faces, or an empty handle
+ * if the file cannot be read or its format is not supported
+ */
+Dali::Texture LoadKtxTexture(const std::string &path,
+                             KtxProfile *profile = nullptr);
+
+#endif // KTX_LOADER_H
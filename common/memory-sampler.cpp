@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "memory-sampler.h"
+
+// EXTERNAL INCLUDES
+#include <malloc.h>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+/**
+ * @brief Read the value in kB of the given field of a /proc file such as
+ * /proc/self/status, e.g. "VmRSS:".
+ * @return The value, or 0 if the file or the field cannot be read
+ */
+uint64_t ReadProcField(const char* fileName, const char* field)
+{
+  FILE* file = fopen(fileName, "r");
+  if(!file)
+  {
+    return 0u;
+  }
+
+  uint64_t     value  = 0u;
+  const size_t length = strlen(field);
+  char         line[256];
+  while(fgets(line, sizeof(line), file))
+  {
+    if(!strncmp(line, field, length))
+    {
+      sscanf(line + length, "%" SCNu64, &value);
+      break;
+    }
+  }
+  fclose(file);
+  return value;
+}
+
+/**
+ * @brief Check whether a mapping of /proc/self/maps is a buffer of the GPU driver.
+ */
+bool IsGpuMapping(const char* path)
+{
+  static const char* GPU_MAPPINGS[] = {"/dev/dri/", "/dev/mali", "/dev/kgsl", "/dmabuf", "anon_inode:dmabuf"};
+  for(const char* prefix : GPU_MAPPINGS)
+  {
+    if(!strncmp(path, prefix, strlen(prefix)))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void SampleGpuMappings(MemorySample& sample)
+{
+  FILE* file = fopen("/proc/self/maps", "r");
+  if(!file)
+  {
+    return;
+  }
+
+  char line[512];
+  while(fgets(line, sizeof(line), file))
+  {
+    // The fields are: address perms offset dev inode path
+    uintptr_t start = 0u, end = 0u;
+    int       pathOffset = 0;
+    if(sscanf(line, "%" SCNxPTR "-%" SCNxPTR " %*s %*s %*s %*s %n", &start, &end, &pathOffset) >= 2 && pathOffset > 0 && IsGpuMapping(line + pathOffset))
+    {
+      sample.gpuKb += (end - start) / 1024u;
+      ++sample.gpuBuffers;
+    }
+  }
+  fclose(file);
+}
+} // namespace
+
+MemorySample SampleMemory()
+{
+  MemorySample sample;
+  sample.rssKb = ReadProcField("/proc/self/status", "VmRSS:");
+
+  // The summary of smaps is cheap to read, unlike smaps itself (Linux 4.14 and later)
+  sample.pssKb = ReadProcField("/proc/self/smaps_rollup", "Pss:");
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  struct mallinfo2 info = mallinfo2();
+  sample.heapKb         = (info.uordblks + info.hblkhd) / 1024u;
+#else
+  struct mallinfo info = mallinfo();
+  sample.heapKb        = (static_cast<unsigned int>(info.uordblks) + static_cast<unsigned int>(info.hblkhd)) / 1024u;
+#endif
+
+  SampleGpuMappings(sample);
+  return sample;
+}
+
+uint64_t TakePeakRss()
+{
+  const uint64_t peak = ReadProcField("/proc/self/status", "VmHWM:");
+
+  // Writing 5 to clear_refs resets the peak to the current resident set size
+  FILE* file = fopen("/proc/self/clear_refs", "w");
+  if(file)
+  {
+    fputs("5", file);
+    fclose(file);
+  }
+  return peak;
+}
+
+uint64_t GetPeakRss()
+{
+  return ReadProcField("/proc/self/status", "VmHWM:");
+}
+
+double GetGrowthKb(uint64_t beforeKb, uint64_t afterKb)
+{
+  return afterKb > beforeKb ? static_cast<double>(afterKb - beforeKb) : 0.0;
+}
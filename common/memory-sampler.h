@@ -0,0 +1,66 @@
+#ifndef MEMORY_SAMPLER_H
+#define MEMORY_SAMPLER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+/**
+ * @brief The memory used by the test process at one point in time.
+ *
+ * DALi has no public count of its live textures, so the GPU side is measured
+ * from the buffers of the GPU driver mapped into the process (DRM, Mali, KGSL
+ * and dma-buf mappings). With a software renderer such as llvmpipe, the
+ * textures are in the heap instead.
+ */
+struct MemorySample {
+  uint64_t rssKb = 0u;      ///< The resident set size
+  uint64_t pssKb = 0u;      ///< The proportional set size, or 0 if unknown
+  uint64_t heapKb = 0u;     ///< The memory allocated from the glibc heap
+  uint64_t gpuKb = 0u;      ///< The size of the mapped GPU buffers
+  uint32_t gpuBuffers = 0u; ///< The number of mapped GPU buffers
+};
+
+/**
+ * @brief Sample the memory of the process from /proc and mallinfo2.
+ */
+MemorySample SampleMemory();
+
+/**
+ * @brief Get the peak resident set size since the last call, and reset it.
+ * @return The peak in kB, or 0 if it cannot be read
+ */
+uint64_t TakePeakRss();
+
+/**
+ * @brief Get the peak resident set size since the last call of TakePeakRss,
+ * without resetting it.
+ * @return The peak in kB, or 0 if it cannot be read
+ */
+uint64_t GetPeakRss();
+
+/**
+ * @brief Get the growth between two samples of a size, e.g. of the heap.
+ * @param[in] beforeKb The size sampled first, in kB
+ * @param[in] afterKb The size sampled next, in kB
+ * @return The growth in kB, or 0 if the size has shrunk
+ */
+double GetGrowthKb(uint64_t beforeKb, uint64_t afterKb);
+
+#endif // MEMORY_SAMPLER_H
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "mesh-blob.h"
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/devel-api/builder/json-parser.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+
+using namespace Dali;
+using Dali::Toolkit::JsonParser;
+using Dali::Toolkit::TreeNode;
+
+namespace
+{
+/**
+ * @brief The format of an attribute, as in the shaders of Scene3D.
+ */
+struct AttributeFormat
+{
+  const char*    key;  ///< The key of its range in the DLI mesh
+  const char*    name; ///< The name of the vertex attribute
+  Property::Type type;
+  uint32_t       size;
+};
+
+const AttributeFormat ATTRIBUTE_FORMATS[MESH_ATTRIBUTE_COUNT] = {
+  {"positions", "aPosition", Property::VECTOR3, sizeof(Vector3)},
+  {"normals", "aNormal", Property::VECTOR3, sizeof(Vector3)},
+  {"textures", "aTexCoord", Property::VECTOR2, sizeof(Vector2)},
+  {"tangents", "aTangent", Property::VECTOR3, sizeof(Vector3)},
+  {"joints0", "aJoints", Property::VECTOR4, sizeof(Vector4)},
+  {"weights0", "aWeights", Property::VECTOR4, sizeof(Vector4)},
+};
+
+const char* SOURCE_NAMES[] = {
+  "read",
+  "mapped",
+};
+
+bool GetRange(const TreeNode* node, MeshBlobRange& range)
+{
+  const TreeNode* offset = node ? node->GetChild("byteOffset") : nullptr;
+  const TreeNode* length = node ? node->GetChild("byteLength") : nullptr;
+  if(!offset || !length || offset->GetType() != TreeNode::INTEGER || length->GetType() != TreeNode::INTEGER ||
+     offset->GetInteger() < 0 || length->GetInteger() <= 0)
+  {
+    return false;
+  }
+  range.offset = static_cast<uint32_t>(offset->GetInteger());
+  range.length = static_cast<uint32_t>(length->GetInteger());
+  return true;
+}
+
+/**
+ * @brief A read-only mapping of a whole file, released on destruction.
+ */
+class MappedFile
+{
+public:
+  explicit MappedFile(const std::string& path)
+  {
+    const int descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(descriptor < 0)
+    {
+      return;
+    }
+
+    struct stat status;
+    if(fstat(descriptor, &status) == 0 && status.st_size > 0)
+    {
+      void* data = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+      if(data != MAP_FAILED)
+      {
+        mData = static_cast<const uint8_t*>(data);
+        mSize = static_cast<size_t>(status.st_size);
+
+        // The ranges are copied once each, in order, so the file is read ahead and not kept
+        madvise(data, mSize, MADV_SEQUENTIAL);
+        madvise(data, mSize, MADV_WILLNEED);
+      }
+    }
+    close(descriptor); // The mapping keeps the file
+  }
+
+  ~MappedFile()
+  {
+    if(mData)
+    {
+      munmap(const_cast<uint8_t*>(mData), mSize);
+    }
+  }
+
+  MappedFile(const MappedFile&)            = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * @brief Get a range of the file, or nullptr if it is empty or beyond the end of the file.
+   */
+  const uint8_t* GetRange(const MeshBlobRange& range) const
+  {
+    if(!mData || range.length == 0u || static_cast<uint64_t>(range.offset) + range.length > mSize)
+    {
+      return nullptr;
+    }
+    return mData + range.offset;
+  }
+
+private:
+  const uint8_t* mData = nullptr;
+  size_t         mSize = 0u;
+};
+
+/**
+ * @brief The ranges of a mesh read into heap buffers, as the raw data of Scene3D::Loader.
+ */
+struct RawMesh
+{
+  std::vector<uint8_t> indices;
+  std::vector<uint8_t> attributes[MESH_ATTRIBUTE_COUNT];
+};
+
+bool ReadRange(std::ifstream& file, const MeshBlobRange& range, std::vector<uint8_t>& buffer)
+{
+  if(range.length == 0u)
+  {
+    return true;
+  }
+  buffer.resize(range.length);
+  file.seekg(range.offset);
+  return static_cast<bool>(file.read(reinterpret_cast<char*>(buffer.data()), range.length));
+}
+
+RawMesh ReadMesh(const MeshBlob& blob)
+{
+  RawMesh       raw;
+  std::ifstream file(blob.path, std::ios::binary);
+  bool          read = ReadRange(file, blob.indices, raw.indices);
+  for(int i = 0; i < MESH_ATTRIBUTE_COUNT; ++i)
+  {
+    read = read && ReadRange(file, blob.attributes[i], raw.attributes[i]);
+  }
+  return read ? std::move(raw) : RawMesh();
+}
+
+const uint8_t* GetData(const std::vector<uint8_t>& buffer)
+{
+  return buffer.empty() ? nullptr : buffer.data();
+}
+
+/**
+ * @brief Create the geometry of a mesh from its ranges, which the vertex buffers copy.
+ * @param[in] indices The indices, or nullptr if the mesh is not indexed
+ * @param[in] attributes The data of each attribute, or nullptr if the mesh does not have it
+ * @return The geometry, or an empty handle if the mesh has no positions
+ */
+Geometry CreateGeometry(const MeshBlob& blob, const uint8_t* indices, const uint8_t* const attributes[MESH_ATTRIBUTE_COUNT])
+{
+  if(!attributes[MESH_POSITIONS])
+  {
+    return Geometry();
+  }
+
+  Geometry geometry = Geometry::New();
+  for(int i = 0; i < MESH_ATTRIBUTE_COUNT; ++i)
+  {
+    if(!attributes[i])
+    {
+      continue;
+    }
+    const AttributeFormat& format = ATTRIBUTE_FORMATS[i];
+    Property::Map          vertexFormat;
+    vertexFormat[format.name] = format.type;
+
+    VertexBuffer vertexBuffer = VertexBuffer::New(vertexFormat);
+    vertexBuffer.SetData(attributes[i], blob.attributes[i].length / format.size);
+    geometry.AddVertexBuffer(vertexBuffer);
+  }
+  if(indices)
+  {
+    geometry.SetIndexBuffer(reinterpret_cast<const uint16_t*>(indices), blob.indices.length / sizeof(uint16_t));
+  }
+  geometry.SetType(Geometry::TRIANGLES);
+  return geometry;
+}
+} // namespace
+
+std::vector<MeshBlob> GetSceneMeshBlobs(const std::string& scenePath, const std::string& modelsDir)
+{
+  std::vector<MeshBlob> blobs;
+
+  std::ifstream     file(scenePath);
+  const std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  JsonParser        parser = JsonParser::New();
+  if(!file || !parser.Parse(content) || !parser.GetRoot())
+  {
+    return blobs;
+  }
+
+  const TreeNode* meshes = parser.GetRoot()->GetChild("meshes");
+  if(!meshes)
+  {
+    return blobs;
+  }
+  for(auto iter = meshes->CBegin(); iter != meshes->CEnd(); ++iter)
+  {
+    const TreeNode& mesh      = (*iter).second;
+    const TreeNode* uri       = mesh.GetChild("uri");
+    const TreeNode* primitive = mesh.GetChild("primitive");
+    if(!uri || uri->GetType() != TreeNode::STRING || !strcmp(uri->GetString(), "quad") ||
+       (primitive && primitive->GetType() == TreeNode::STRING && strcmp(primitive->GetString(), "TRIANGLES")))
+    {
+      continue;
+    }
+
+    MeshBlob blob;
+    blob.path = modelsDir + uri->GetString();
+    if(!GetRange(mesh.GetChild("positions"), blob.attributes[MESH_POSITIONS]))
+    {
+      continue; // Generated by Scene3D::Loader, e.g. a quad
+    }
+    for(int i = MESH_POSITIONS + 1; i < MESH_ATTRIBUTE_COUNT; ++i)
+    {
+      GetRange(mesh.GetChild(ATTRIBUTE_FORMATS[i].key), blob.attributes[i]);
+    }
+
+    // The 16 bit indices are given as such to the geometry
+    if(GetRange(mesh.GetChild("indices"), blob.indices) && blob.indices.offset % alignof(uint16_t) != 0u)
+    {
+      continue;
+    }
+    blobs.push_back(blob);
+  }
+  return blobs;
+}
+
+std::vector<Geometry> CreateMeshGeometry(const std::vector<MeshBlob>& blobs, MeshBlobSource source)
+{
+  std::vector<Geometry> geometries;
+  geometries.reserve(blobs.size());
+
+  if(source == MESH_BLOB_READ)
+  {
+    // All the meshes are read before any geometry is created, as by ResourceBundle::LoadRawResources
+    std::vector<RawMesh> rawMeshes;
+    for(const MeshBlob& blob : blobs)
+    {
+      rawMeshes.push_back(ReadMesh(blob));
+    }
+
+    for(size_t i = 0; i < blobs.size(); ++i)
+    {
+      const uint8_t* attributes[MESH_ATTRIBUTE_COUNT];
+      for(int j = 0; j < MESH_ATTRIBUTE_COUNT; ++j)
+      {
+        attributes[j] = GetData(rawMeshes[i].attributes[j]);
+      }
+      geometries.push_back(CreateGeometry(blobs[i], GetData(rawMeshes[i].indices), attributes));
+    }
+    return geometries;
+  }
+
+  // The meshes of a scene share a few files, each is mapped once
+  std::unique_ptr<MappedFile> file;
+  std::string                 filePath;
+  for(const MeshBlob& blob : blobs)
+  {
+    if(!file || blob.path != filePath)
+    {
+      file.reset(); // Before the next one is mapped
+      file     = std::make_unique<MappedFile>(blob.path);
+      filePath = blob.path;
+    }
+
+    const uint8_t* attributes[MESH_ATTRIBUTE_COUNT];
+    bool           inFile = true;
+    for(int i = 0; i < MESH_ATTRIBUTE_COUNT; ++i)
+    {
+      attributes[i] = file->GetRange(blob.attributes[i]);
+      inFile        = inFile && (attributes[i] || blob.attributes[i].length == 0u);
+    }
+    const uint8_t* indices = file->GetRange(blob.indices);
+    inFile                 = inFile && (indices || blob.indices.length == 0u);
+
+    geometries.push_back(inFile ? CreateGeometry(blob, indices, attributes) : Geometry());
+  }
+  return geometries;
+}
+
+const char* GetMeshBlobSourceName(MeshBlobSource source)
+{
+  return SOURCE_NAMES[source];
+}
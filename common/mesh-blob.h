@@ -0,0 +1,100 @@
+#ifndef MESH_BLOB_H
+#define MESH_BLOB_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/dali.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The vertex attributes of a DLI mesh, each in its own range of the
+ * blob and its own vertex buffer.
+ */
+enum MeshAttribute {
+  MESH_POSITIONS, ///< "positions", Vector3
+  MESH_NORMALS,   ///< "normals", Vector3
+  MESH_TEXCOORDS, ///< "textures", Vector2
+  MESH_TANGENTS,  ///< "tangents", Vector3
+  MESH_JOINTS,    ///< "joints0", Vector4
+  MESH_WEIGHTS,   ///< "weights0", Vector4
+  MESH_ATTRIBUTE_COUNT
+};
+
+/**
+ * @brief How the ranges of a mesh blob reach the vertex buffers.
+ */
+enum MeshBlobSource {
+  MESH_BLOB_READ,   ///< Read into heap buffers first, as Scene3D::Loader does
+  MESH_BLOB_MAPPED, ///< Given straight from a read-only mapping of the file
+};
+
+/**
+ * @brief A range of bytes of a mesh blob, empty if the mesh does not have it.
+ */
+struct MeshBlobRange {
+  uint32_t offset = 0u;
+  uint32_t length = 0u;
+};
+
+/**
+ * @brief The geometry of a DLI mesh in its binary file, e.g.
+ * models/robot/Bob-Walk.bin.
+ */
+struct MeshBlob {
+  std::string path;      ///< The path of the binary file
+  MeshBlobRange indices; ///< 16 bit indices of triangles
+  MeshBlobRange attributes[MESH_ATTRIBUTE_COUNT];
+};
+
+/**
+ * @brief Get the meshes of a DLI scene which are triangles in a binary file,
+ * i.e. all but the quads and the generated meshes.
+ * @param[in] scenePath The path of the DLI scene
+ * @param[in] modelsDir The directory of the mesh files, with a trailing slash
+ * @return The meshes, in the order of the scene, or none if it cannot be read
+ */
+std::vector<MeshBlob> GetSceneMeshBlobs(const std::string &scenePath,
+                                        const std::string &modelsDir);
+
+/**
+ * @brief Create the geometry of meshes from their blobs.
+ *
+ * Scene3D::Loader reads every range of a mesh into a heap buffer before the
+ * vertex buffers are created from them. With MESH_BLOB_MAPPED, each file is
+ * mapped once instead, and the vertex buffers are given the ranges straight
+ * from the mapping, which is released as soon as the geometry is created: the
+ * vertex buffers keep their own copy until it is uploaded.
+ *
+ * It must be called on the event thread.
+ * @param[in] blobs The meshes
+ * @param[in] source How the ranges are given to the vertex buffers
+ * @return The geometry of each mesh, an empty handle for the meshes which
+ * cannot be read
+ */
+std::vector<Dali::Geometry>
+CreateMeshGeometry(const std::vector<MeshBlob> &blobs, MeshBlobSource source);
+
+/**
+ * @brief Get the name of a source, e.g. "mapped".
+ */
+const char *GetMeshBlobSourceName(MeshBlobSource source);
+
+#endif // MESH_BLOB_H
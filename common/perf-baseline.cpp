@@ -0,0 +1,514 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "perf-baseline.h"
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/devel-api/builder/json-parser.h>
+#include <dali-toolkit/devel-api/builder/tree-node.h>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+// INTERNAL INCLUDES
+#include "perf-statistics.h"
+
+using Dali::Toolkit::JsonParser;
+using Dali::Toolkit::TreeNode;
+
+namespace
+{
+// The metrics which are not baselined, they depend on the state of the shader cache
+const std::string SHADER_CACHE_METRIC_PREFIX("shader-cache.");
+
+/**
+ * @brief Get the value of a number of the baseline.
+ * @return The number, or the default value if the node is not a number
+ */
+double GetNumber(const TreeNode* node, double defaultValue)
+{
+  if(node && node->GetType() == TreeNode::INTEGER)
+  {
+    return node->GetInteger();
+  }
+  if(node && node->GetType() == TreeNode::FLOAT)
+  {
+    return node->GetFloat();
+  }
+  return defaultValue;
+}
+
+/**
+ * @brief Check one measure of a step against the baseline.
+ * @return Whether the measure has regressed
+ */
+bool CheckMeasure(FILE* output, int index, const std::string& name, const char* measure, double value, double expected, double tolerance)
+{
+  if(value < 0.0 || expected < 0.0)
+  {
+    return false;
+  }
+
+  const double limit = expected * (1.0 + tolerance / 100.0);
+  if(value <= limit)
+  {
+    return false;
+  }
+
+  fprintf(output, "PERF-REGRESSION: step %d (%s) %s %.1f exceeds the baseline %.1f by %.0f%% (tolerance %.0f%%)\n", index, name.c_str(), measure, value, expected, expected > 0.0 ? 100.0 * (value - expected) / expected : 100.0, tolerance);
+  return true;
+}
+
+/**
+ * @brief Check whether a metric is better when it is higher, e.g. a speed-up or the time saved.
+ */
+bool IsHigherBetter(const std::string& name, const std::string& unit)
+{
+  const std::string saved(".saved");
+  return unit == "x" || (name.size() > saved.size() && name.compare(name.size() - saved.size(), saved.size(), saved) == 0);
+}
+
+/**
+ * @brief Check a metric reported by the test against the baseline.
+ * @return Whether the metric has regressed
+ */
+bool CheckMetric(FILE* output, const std::string& name, const std::string& unit, double value, double expected, double tolerance)
+{
+  // A metric which is 0 in the baseline, e.g. a count, has no scale to compare with
+  if(expected <= 0.0)
+  {
+    return false;
+  }
+
+  const bool   higherBetter = IsHigherBetter(name, unit);
+  const double change       = 100.0 * (higherBetter ? expected - value : value - expected) / expected;
+  if(change <= tolerance)
+  {
+    return false;
+  }
+
+  fprintf(output, "PERF-REGRESSION: metric %s %.3f %s is %s than the baseline %.3f by %.0f%% (tolerance %.0f%%)\n", name.c_str(), value, unit.c_str(), higherBetter ? "lower" : "higher", expected, change, tolerance);
+  return true;
+}
+
+/**
+ * @brief Parse a JSON file.
+ * @return Whether the file exists and is valid
+ */
+bool ParseFile(JsonParser& parser, const std::string& fileName)
+{
+  std::ifstream file(fileName);
+  if(!file)
+  {
+    return false;
+  }
+  std::stringstream content;
+  content << file.rdbuf();
+
+  if(!parser.Parse(content.str()) || !parser.GetRoot())
+  {
+    fprintf(stderr, "Unable to parse %s: %s\n", fileName.c_str(), parser.GetErrorDescription().c_str());
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Get the string of a child of a node, or an empty string.
+ */
+std::string GetString(const TreeNode& node, const char* name)
+{
+  const TreeNode* child = node.GetChild(name);
+  return (child && child->GetType() == TreeNode::STRING) ? child->GetString() : std::string();
+}
+
+/**
+ * @brief Get the boolean of a child of a node, or false.
+ */
+bool GetBoolean(const TreeNode& node, const char* name)
+{
+  const TreeNode* child = node.GetChild(name);
+  return child && child->GetType() == TreeNode::BOOLEAN && child->GetBoolean();
+}
+
+/**
+ * @brief Get the name of a gate, as written in the baseline file.
+ */
+const char* GetGateName(PerfGate gate)
+{
+  switch(gate)
+  {
+    case PerfGate::OFF:
+      return "off";
+    case PerfGate::FAIL:
+      return "fail";
+    case PerfGate::WARN:
+    default:
+      return "warn";
+  }
+}
+
+/**
+ * @brief The samples of one step, one per run.
+ */
+struct StepSamples
+{
+  std::string         name;
+  std::vector<double> durationMs;
+  std::vector<double> frameMs;
+  std::vector<double> peakRssKb;
+};
+
+/**
+ * @brief The samples of one metric, one per run.
+ */
+struct MetricSamples
+{
+  std::string         unit;
+  std::vector<double> values;
+};
+
+/**
+ * @brief Write the median of the samples of a measure, if there are any.
+ */
+void WriteMedian(FILE* output, const char* measure, const std::vector<double>& samples)
+{
+  if(!samples.empty())
+  {
+    fprintf(output, ", \"%s\": %.3f", measure, ComputeStatistics(samples).median);
+  }
+}
+} // namespace
+
+bool PerfBaseline::Load(const std::string& fileName)
+{
+  mLoaded = false;
+  mSteps.clear();
+  mMetrics.clear();
+
+  JsonParser parser = JsonParser::New();
+  if(!ParseFile(parser, fileName))
+  {
+    return false;
+  }
+  const TreeNode* root = parser.GetRoot();
+
+  if(const TreeNode* gate = root->GetChild("gate"))
+  {
+    if(gate->GetType() == TreeNode::STRING)
+    {
+      mGate = ParseGate(gate->GetString(), PerfGate::WARN);
+    }
+  }
+
+  if(const TreeNode* tolerance = root->GetChild("tolerance"))
+  {
+    mDurationTolerance = GetNumber(tolerance->GetChild("durationPercent"), mDurationTolerance);
+    mFrameTolerance    = GetNumber(tolerance->GetChild("frameMsPercent"), mFrameTolerance);
+    mMemoryTolerance   = GetNumber(tolerance->GetChild("peakRssPercent"), mMemoryTolerance);
+    mMetricTolerance   = GetNumber(tolerance->GetChild("metricPercent"), mMetricTolerance);
+  }
+
+  if(const TreeNode* steps = root->GetChild("steps"))
+  {
+    for(auto iter = steps->CBegin(); iter != steps->CEnd(); ++iter)
+    {
+      const TreeNode& node = (*iter).second;
+
+      Step step;
+      step.index      = static_cast<int>(GetNumber(node.GetChild("index"), 0.0));
+      step.durationMs = GetNumber(node.GetChild("durationMs"), -1.0);
+      step.frameMs    = GetNumber(node.GetChild("frameMs"), -1.0);
+      step.peakRssKb  = GetNumber(node.GetChild("peakRssKb"), -1.0);
+      if(const TreeNode* name = node.GetChild("name"))
+      {
+        step.name = name->GetString();
+      }
+      mSteps.push_back(step);
+    }
+  }
+
+  if(const TreeNode* metrics = root->GetChild("metrics"))
+  {
+    for(auto iter = metrics->CBegin(); iter != metrics->CEnd(); ++iter)
+    {
+      const TreeNode& node = (*iter).second;
+
+      Metric metric;
+      metric.name  = GetString(node, "name");
+      metric.value = GetNumber(node.GetChild("value"), 0.0);
+      metric.unit  = GetString(node, "unit");
+      mMetrics.push_back(metric);
+    }
+  }
+
+  mLoaded = true;
+  return true;
+}
+
+bool PerfBaseline::IsLoaded() const
+{
+  return mLoaded;
+}
+
+PerfGate PerfBaseline::GetGate() const
+{
+  return mGate;
+}
+
+int PerfBaseline::Check(const TestResults& testResults, FILE* output) const
+{
+  const std::vector<StepResult> results = testResults.GetResults();
+  const std::vector<StepTiming> timings = testResults.GetTimings();
+  const std::vector<StepMemory> memory  = testResults.GetMemory();
+  const std::vector<TestMetric> metrics = testResults.GetMetrics();
+
+  int regressions = 0;
+  for(const auto& step : mSteps)
+  {
+    // The comparison which counts is the last one of the step, i.e. the one which has not been retried
+    double durationMs = -1.0;
+    double frameMs    = -1.0;
+    for(const auto& result : results)
+    {
+      if(result.stepIndex == step.index && !result.retried)
+      {
+        durationMs = result.durationMs;
+        frameMs    = result.frameMs;
+      }
+    }
+
+    // The whole step, whether or not it has captured the window
+    for(const auto& timing : timings)
+    {
+      if(timing.stepIndex == step.index)
+      {
+        durationMs = timing.durationMs;
+      }
+    }
+
+    double peakRssKb = -1.0;
+    for(const auto& stepMemory : memory)
+    {
+      if(stepMemory.stepIndex == step.index && stepMemory.peakRssKb > 0u)
+      {
+        peakRssKb = static_cast<double>(stepMemory.peakRssKb);
+      }
+    }
+
+    regressions += CheckMeasure(output, step.index, step.name, "durationMs", durationMs, step.durationMs, mDurationTolerance);
+    regressions += CheckMeasure(output, step.index, step.name, "frameMs", frameMs, step.frameMs, mFrameTolerance);
+    regressions += CheckMeasure(output, step.index, step.name, "peakRssKb", peakRssKb, step.peakRssKb, mMemoryTolerance);
+  }
+
+  for(const auto& expected : mMetrics)
+  {
+    for(const auto& metric : metrics)
+    {
+      if(metric.name == expected.name)
+      {
+        regressions += CheckMetric(output, metric.name, metric.unit, metric.value, expected.value, mMetricTolerance);
+        break;
+      }
+    }
+  }
+  fflush(output);
+  return regressions;
+}
+
+bool PerfBaseline::Write(const std::string& fileName, const std::vector<std::string>& resultsFiles)
+{
+  // The gate and the tolerances are chosen by hand, keep them
+  PerfBaseline previous;
+  previous.Load(fileName);
+
+  std::map<int, StepSamples>            steps;
+  std::map<std::string, MetricSamples> metrics;
+  std::vector<std::string>             metricOrder;
+  int                                  runs = 0;
+  for(const auto& resultsFile : resultsFiles)
+  {
+    JsonParser parser = JsonParser::New();
+    if(!ParseFile(parser, resultsFile))
+    {
+      fprintf(stderr, "Unable to read the results %s, the run is not in the baseline\n", resultsFile.c_str());
+      continue;
+    }
+    const TreeNode* root = parser.GetRoot();
+    ++runs;
+
+    // The durations of the steps which have not captured the window are only in the timings
+    const TreeNode* timings = root->GetChild("timings");
+    if(timings && timings->Size() > 0u)
+    {
+      for(auto iter = timings->CBegin(); iter != timings->CEnd(); ++iter)
+      {
+        const TreeNode& node  = (*iter).second;
+        StepSamples&    step  = steps[static_cast<int>(GetNumber(node.GetChild("index"), 0.0))];
+        const double    value = GetNumber(node.GetChild("durationMs"), -1.0);
+        step.name             = GetString(node, "name");
+        if(value >= 0.0)
+        {
+          step.durationMs.push_back(value);
+        }
+      }
+    }
+
+    if(const TreeNode* comparisons = root->GetChild("steps"))
+    {
+      for(auto iter = comparisons->CBegin(); iter != comparisons->CEnd(); ++iter)
+      {
+        const TreeNode& node = (*iter).second;
+        if(GetBoolean(node, "retried"))
+        {
+          continue;
+        }
+        StepSamples& step = steps[static_cast<int>(GetNumber(node.GetChild("index"), 0.0))];
+        step.name         = GetString(node, "name");
+
+        const double frameMs = GetNumber(node.GetChild("frameMs"), -1.0);
+        if(frameMs >= 0.0)
+        {
+          step.frameMs.push_back(frameMs);
+        }
+
+        // The results of an older test have no timings, the comparison gives the duration of its step
+        const double durationMs = GetNumber(node.GetChild("durationMs"), -1.0);
+        if(!(timings && timings->Size() > 0u) && durationMs >= 0.0)
+        {
+          step.durationMs.push_back(durationMs);
+        }
+      }
+    }
+
+    if(const TreeNode* memory = root->GetChild("memory"))
+    {
+      for(auto iter = memory->CBegin(); iter != memory->CEnd(); ++iter)
+      {
+        const TreeNode& node      = (*iter).second;
+        const double    peakRssKb = GetNumber(node.GetChild("peakRssKb"), -1.0);
+        if(peakRssKb > 0.0)
+        {
+          steps[static_cast<int>(GetNumber(node.GetChild("index"), 0.0))].peakRssKb.push_back(peakRssKb);
+        }
+      }
+    }
+
+    if(const TreeNode* runMetrics = root->GetChild("metrics"))
+    {
+      for(auto iter = runMetrics->CBegin(); iter != runMetrics->CEnd(); ++iter)
+      {
+        const TreeNode&   node = (*iter).second;
+        const std::string name = GetString(node, "name");
+        if(name.empty() || name.compare(0, SHADER_CACHE_METRIC_PREFIX.size(), SHADER_CACHE_METRIC_PREFIX) == 0)
+        {
+          continue;
+        }
+        if(metrics.find(name) == metrics.end())
+        {
+          metricOrder.push_back(name);
+        }
+        MetricSamples& metric = metrics[name];
+        metric.unit           = GetString(node, "unit");
+        metric.values.push_back(GetNumber(node.GetChild("value"), 0.0));
+      }
+    }
+  }
+
+  if(runs == 0)
+  {
+    fprintf(stderr, "No results to write the performance baseline %s from\n", fileName.c_str());
+    return false;
+  }
+
+  const std::string newFileName = fileName + ".new";
+  FILE*             output      = fopen(newFileName.c_str(), "w");
+  if(!output)
+  {
+    fprintf(stderr, "Unable to open the performance baseline %s\n", newFileName.c_str());
+    return false;
+  }
+
+  fprintf(output, "{\n  \"gate\": \"%s\",\n", GetGateName(previous.mGate));
+  fprintf(output,
+          "  \"tolerance\": {\"durationPercent\": %g, \"frameMsPercent\": %g, \"peakRssPercent\": %g, \"metricPercent\": %g},\n",
+          previous.mDurationTolerance,
+          previous.mFrameTolerance,
+          previous.mMemoryTolerance,
+          previous.mMetricTolerance);
+  fprintf(output, "  \"runs\": %d,\n  \"steps\": [", runs);
+
+  const char* separator = "\n";
+  for(const auto& [index, step] : steps)
+  {
+    if(index <= 0)
+    {
+      continue;
+    }
+    fprintf(output, "%s    {\"index\": %d, \"name\": ", separator, index);
+    WriteJsonString(output, step.name);
+    WriteMedian(output, "durationMs", step.durationMs);
+    WriteMedian(output, "frameMs", step.frameMs);
+    if(!step.peakRssKb.empty())
+    {
+      fprintf(output, ", \"peakRssKb\": %.0f", ComputeStatistics(step.peakRssKb).median);
+    }
+    fprintf(output, "}");
+    separator = ",\n";
+  }
+  fprintf(output, "\n  ],\n  \"metrics\": [");
+
+  separator = "\n";
+  for(const auto& name : metricOrder)
+  {
+    const MetricSamples& metric = metrics[name];
+    fprintf(output, "%s    {\"name\": ", separator);
+    WriteJsonString(output, name);
+    fprintf(output, ", \"value\": %.3f, \"unit\": ", ComputeStatistics(metric.values).median);
+    WriteJsonString(output, metric.unit);
+    fprintf(output, "}");
+    separator = ",\n";
+  }
+  fprintf(output, "\n  ]\n}\n");
+
+  if(fclose(output) != 0 || rename(newFileName.c_str(), fileName.c_str()) != 0)
+  {
+    fprintf(stderr, "Unable to write the performance baseline %s\n", fileName.c_str());
+    remove(newFileName.c_str());
+    return false;
+  }
+  return true;
+}
+
+PerfGate PerfBaseline::ParseGate(const std::string& name, PerfGate defaultGate)
+{
+  if(name == "off")
+  {
+    return PerfGate::OFF;
+  }
+  if(name == "warn")
+  {
+    return PerfGate::WARN;
+  }
+  if(name == "fail")
+  {
+    return PerfGate::FAIL;
+  }
+  return defaultGate;
+}
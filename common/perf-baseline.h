@@ -0,0 +1,148 @@
+#ifndef PERF_BASELINE_H
+#define PERF_BASELINE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "test-results.h"
+
+// The exit value of a test which is slower than its performance baseline
+#define PERF_REGRESSION_EXIT_VALUE 102
+
+// The name of the baseline file, installed next to the images of the test
+#define PERF_BASELINE_FILE "perf-baseline.json"
+
+/**
+ * @brief What a regression against the performance baseline does.
+ */
+enum class PerfGate {
+  OFF,  ///< The baseline is not checked
+  WARN, ///< The regressions are reported
+  FAIL  ///< The regressions are reported and fail the test
+};
+
+/**
+ * @brief The expected performance of a visual test.
+ *
+ * The baseline is a perf-baseline.json file in the directory of the test,
+ * installed next to its images, and normally written by
+ * execute.sh --rebaseline-perf from the median of several runs (see Write):
+ *
+ * @code
+ * {
+ *   "gate": "warn",
+ *   "tolerance": {"durationPercent": 50, "frameMsPercent": 50,
+ *                 "peakRssPercent": 20, "metricPercent": 50},
+ *   "runs": 5,
+ *   "steps": [
+ *     {"index": 1, "name": "step-1", "durationMs": 120.5, "frameMs": 16.9,
+ *      "peakRssKb": 81234}
+ *   ],
+ *   "metrics": [
+ *     {"name": "scene.gltf.total", "value": 84.2, "unit": "ms"}
+ *   ]
+ * }
+ * @endcode
+ *
+ * Every step has a duration, whether or not it captures the window; the frame
+ * time only comes from the steps which do. A step regresses when one of its
+ * measures exceeds the baseline by more than the tolerance. The steps are
+ * matched by index and the metrics by name, and a measure which is missing
+ * from either side is not checked. A metric in "x" (e.g. a speed-up) or a
+ * saving regresses when it falls below the baseline instead.
+ */
+class PerfBaseline {
+public:
+  /**
+   * @brief Load the baseline.
+   * @param[in] fileName The baseline file
+   * @return Whether the file exists and is valid
+   */
+  bool Load(const std::string &fileName);
+
+  /**
+   * @brief Check whether a baseline has been loaded.
+   */
+  bool IsLoaded() const;
+
+  /**
+   * @brief Get the gate given by the baseline file, WARN by default.
+   */
+  PerfGate GetGate() const;
+
+  /**
+   * @brief Compare the measures of a run with the baseline, and write a
+   * PERF-REGRESSION: line for each regression.
+   * @param[in] results The steps, comparisons and metrics of the run
+   * @param[in] output The file to write the regressions to
+   * @return The number of regressions
+   */
+  int Check(const TestResults &results, FILE *output) const;
+
+  /**
+   * @brief Write a baseline from the median of the measures of several runs.
+   *
+   * The gate and the tolerances of an existing baseline are kept. The metrics
+   * of the shader cache are left out, they depend on the state of the cache
+   * rather than on the speed of the test.
+   * @param[in] fileName The baseline file
+   * @param[in] resultsFiles The results files of the runs, see TestResults
+   * @return Whether the baseline has been written
+   */
+  static bool Write(const std::string &fileName,
+                    const std::vector<std::string> &resultsFiles);
+
+  /**
+   * @brief Parse the name of a gate, i.e. "off", "warn" or "fail".
+   * @param[in] name The name of the gate
+   * @param[in] defaultGate The gate if the name is not known
+   */
+  static PerfGate ParseGate(const std::string &name, PerfGate defaultGate);
+
+private:
+  struct Step {
+    int index = 0;
+    std::string name;
+    double durationMs = -1.0; ///< Negative if not in the baseline
+    double frameMs = -1.0;
+    double peakRssKb = -1.0;
+  };
+
+  struct Metric {
+    std::string name;
+    double value = 0.0;
+    std::string unit;
+  };
+
+  bool mLoaded = false;
+  PerfGate mGate = PerfGate::WARN;
+  double mDurationTolerance = 50.0; ///< In percent of the baseline
+  double mFrameTolerance = 50.0;
+  double mMemoryTolerance = 20.0;
+  double mMetricTolerance = 50.0;
+  std::vector<Step> mSteps;
+  std::vector<Metric> mMetrics;
+};
+
+#endif // PERF_BASELINE_H
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "perf-counters.h"
+
+// EXTERNAL INCLUDES
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+bool gPerfCounters = false;
+
+namespace
+{
+const uint64_t PERF_COUNTER_CONFIGS[PERF_COUNTER_COUNT] = {
+  PERF_COUNT_HW_CPU_CYCLES,
+  PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CACHE_MISSES,
+  PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+const char* PERF_COUNTER_NAMES[PERF_COUNTER_COUNT] = {
+  "cycles",
+  "instructions",
+  "cacheMisses",
+  "branchMisses",
+};
+
+int OpenCounter(uint64_t config)
+{
+  struct perf_event_attr attributes;
+  memset(&attributes, 0, sizeof(attributes));
+  attributes.size           = sizeof(attributes);
+  attributes.type           = PERF_TYPE_HARDWARE;
+  attributes.config         = config;
+  attributes.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  attributes.inherit        = 1; // Count the threads created afterwards, which rules out group reads
+  attributes.exclude_kernel = 1; // Permitted with perf_event_paranoid 2
+  attributes.exclude_hv     = 1;
+
+  // This process on any CPU
+  return static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+}
+} // namespace
+
+PerfCounterValues PerfCounterValues::operator-(const PerfCounterValues& other) const
+{
+  PerfCounterValues difference;
+  for(int i = 0; i < PERF_COUNTER_COUNT; ++i)
+  {
+    if(values[i] >= 0 && other.values[i] >= 0)
+    {
+      difference.values[i] = values[i] - other.values[i];
+    }
+  }
+  return difference;
+}
+
+PerfCounterValues& PerfCounterValues::operator+=(const PerfCounterValues& other)
+{
+  for(int i = 0; i < PERF_COUNTER_COUNT; ++i)
+  {
+    if(other.values[i] >= 0)
+    {
+      values[i] = (values[i] >= 0 ? values[i] : 0) + other.values[i];
+    }
+  }
+  return *this;
+}
+
+const char* PerfCounterValues::GetName(int counter)
+{
+  return PERF_COUNTER_NAMES[counter];
+}
+
+PerfCounters::PerfCounters()
+{
+  for(int& fileDescriptor : mFileDescriptors)
+  {
+    fileDescriptor = -1;
+  }
+}
+
+PerfCounters::~PerfCounters()
+{
+  for(int fileDescriptor : mFileDescriptors)
+  {
+    if(fileDescriptor >= 0)
+    {
+      close(fileDescriptor);
+    }
+  }
+}
+
+bool PerfCounters::Open()
+{
+  int error = 0;
+  for(int i = 0; i < PERF_COUNTER_COUNT; ++i)
+  {
+    if(mFileDescriptors[i] < 0)
+    {
+      mFileDescriptors[i] = OpenCounter(PERF_COUNTER_CONFIGS[i]);
+      if(mFileDescriptors[i] < 0)
+      {
+        error = errno;
+      }
+    }
+  }
+
+  if(!IsOpen())
+  {
+    printf("PERF: hardware counters are not available (%s), they are not collected\n", strerror(error));
+    fflush(stdout);
+  }
+  return IsOpen();
+}
+
+bool PerfCounters::IsOpen() const
+{
+  for(int fileDescriptor : mFileDescriptors)
+  {
+    if(fileDescriptor >= 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+PerfCounterValues PerfCounters::Read() const
+{
+  PerfCounterValues counters;
+  for(int i = 0; i < PERF_COUNTER_COUNT; ++i)
+  {
+    // value, time enabled, time running
+    uint64_t data[3];
+    if(mFileDescriptors[i] >= 0 && read(mFileDescriptors[i], data, sizeof(data)) == sizeof(data) && data[2] > 0u)
+    {
+      // The counter has only been running part of the time if the kernel has multiplexed it
+      const double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+      counters.values[i] = static_cast<int64_t>(static_cast<double>(data[0]) * scale);
+    }
+  }
+  return counters;
+}
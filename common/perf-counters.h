@@ -0,0 +1,113 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Whether the hardware counters are collected, i.e. --perf-counters.
+ */
+extern bool gPerfCounters;
+
+/**
+ * @brief The hardware counters collected by PerfCounters.
+ */
+enum PerfCounter {
+  PERF_CYCLES,
+  PERF_INSTRUCTIONS,
+  PERF_CACHE_MISSES,
+  PERF_BRANCH_MISSES,
+  PERF_COUNTER_COUNT
+};
+
+/**
+ * @brief The values of the hardware counters. A counter which cannot be read
+ * is negative.
+ */
+struct PerfCounterValues {
+  int64_t values[PERF_COUNTER_COUNT] = {-1, -1, -1, -1};
+
+  /**
+   * @brief Get the difference of each counter from the given values.
+   */
+  PerfCounterValues operator-(const PerfCounterValues &other) const;
+
+  /**
+   * @brief Add the given values to the counters which can be read.
+   */
+  PerfCounterValues &operator+=(const PerfCounterValues &other);
+
+  /**
+   * @brief Get the name of a counter as written in the results, e.g.
+   * "cacheMisses".
+   */
+  static const char *GetName(int counter);
+};
+
+/**
+ * @brief Counts the hardware events of the test process with perf_event_open.
+ *
+ * The counters are inherited by the threads created after Open(), so they
+ * include the update and render threads of DALi which are started by the main
+ * loop. The counters are read without stopping them, and are scaled when the
+ * kernel multiplexes them.
+ *
+ * When perf events are not permitted (see
+ * /proc/sys/kernel/perf_event_paranoid) or not supported, e.g. in a virtual
+ * machine, the counters which cannot be opened read as negative and the test
+ * runs as usual.
+ */
+class PerfCounters {
+public:
+  /**
+   * @brief Constructor.
+   */
+  PerfCounters();
+
+  /**
+   * @brief Destructor. Closes the counters.
+   */
+  ~PerfCounters();
+
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters &operator=(const PerfCounters &) = delete;
+
+  /**
+   * @brief Open and start the counters.
+   * @return Whether at least one counter has been opened
+   */
+  bool Open();
+
+  /**
+   * @brief Check whether at least one counter is open.
+   */
+  bool IsOpen() const;
+
+  /**
+   * @brief Read the current values of the counters.
+   */
+  PerfCounterValues Read() const;
+
+private:
+  int mFileDescriptors[PERF_COUNTER_COUNT];
+};
+
+#endif // PERF_COUNTERS_H
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "perf-statistics.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace
+{
+/**
+ * @brief Get the given percentile of sorted samples, interpolating linearly.
+ */
+double Percentile(const std::vector<double>& sorted, double percentile)
+{
+  if(sorted.empty())
+  {
+    return 0.0;
+  }
+  const double position = percentile / 100.0 * static_cast<double>(sorted.size() - 1u);
+  const size_t lower    = static_cast<size_t>(position);
+  const size_t upper    = std::min(lower + 1u, sorted.size() - 1u);
+  return sorted[lower] + (sorted[upper] - sorted[lower]) * (position - static_cast<double>(lower));
+}
+
+double Median(std::vector<double> samples)
+{
+  std::sort(samples.begin(), samples.end());
+  return Percentile(samples, 50.0);
+}
+
+double MedianAbsoluteDeviation(const std::vector<double>& samples, double median)
+{
+  std::vector<double> deviations;
+  deviations.reserve(samples.size());
+  for(double sample : samples)
+  {
+    deviations.push_back(std::fabs(sample - median));
+  }
+  return Median(deviations);
+}
+
+/**
+ * @brief Remove the outliers from the samples.
+ * @return The number of samples removed
+ */
+size_t RejectOutliers(std::vector<double>& samples)
+{
+  const double median = Median(samples);
+  const double mad    = MedianAbsoluteDeviation(samples, median);
+  if(mad <= 0.0)
+  {
+    return 0u; // More than half of the samples are equal, nothing stands out
+  }
+
+  // 0.6745 makes the score comparable to a standard score for normal samples
+  const size_t count = samples.size();
+  samples.erase(std::remove_if(samples.begin(), samples.end(), [median, mad](double sample) { return 0.6745 * std::fabs(sample - median) / mad > OUTLIER_Z_SCORE; }), samples.end());
+  return count - samples.size();
+}
+
+/**
+ * @brief Draw a sample of the same size with replacement, and get its median.
+ */
+double ResampledMedian(const std::vector<double>& samples, std::mt19937& random)
+{
+  std::uniform_int_distribution<size_t> pick(0u, samples.size() - 1u);
+  std::vector<double>                   resample(samples.size());
+  for(double& value : resample)
+  {
+    value = samples[pick(random)];
+  }
+  return Median(resample);
+}
+
+/**
+ * @brief Get the two-sided p-value of the Mann-Whitney U test, with the normal
+ * approximation corrected for ties.
+ */
+double MannWhitneyPValue(const std::vector<double>& a, const std::vector<double>& b)
+{
+  struct Rank
+  {
+    double value;
+    bool   fromA;
+  };
+  std::vector<Rank> all;
+  for(double value : a)
+  {
+    all.push_back({value, true});
+  }
+  for(double value : b)
+  {
+    all.push_back({value, false});
+  }
+  std::sort(all.begin(), all.end(), [](const Rank& left, const Rank& right) { return left.value < right.value; });
+
+  // The tied values share the mean of their ranks
+  double rankSumA = 0.0;
+  double tieTerm  = 0.0;
+  for(size_t i = 0u; i < all.size();)
+  {
+    size_t j = i;
+    while(j < all.size() && all[j].value == all[i].value)
+    {
+      ++j;
+    }
+    const double rank = (static_cast<double>(i + 1u) + static_cast<double>(j)) / 2.0;
+    for(size_t k = i; k < j; ++k)
+    {
+      rankSumA += all[k].fromA ? rank : 0.0;
+    }
+    const double ties = static_cast<double>(j - i);
+    tieTerm += ties * ties * ties - ties;
+    i = j;
+  }
+
+  const double n1       = static_cast<double>(a.size());
+  const double n2       = static_cast<double>(b.size());
+  const double n        = n1 + n2;
+  const double u        = rankSumA - n1 * (n1 + 1.0) / 2.0;
+  const double mean     = n1 * n2 / 2.0;
+  const double variance = n1 * n2 / 12.0 * ((n + 1.0) - tieTerm / (n * (n - 1.0)));
+  if(variance <= 0.0)
+  {
+    return 1.0;
+  }
+
+  const double z = (std::fabs(u - mean) - 0.5) / std::sqrt(variance);
+  return std::min(1.0, std::erfc(std::max(0.0, z) / std::sqrt(2.0)));
+}
+} // namespace
+
+SampleStatistics ComputeStatistics(std::vector<double> samples)
+{
+  SampleStatistics statistics;
+  if(samples.empty())
+  {
+    return statistics;
+  }
+
+  statistics.outliers = RejectOutliers(samples);
+  std::sort(samples.begin(), samples.end());
+
+  statistics.count  = samples.size();
+  statistics.median = Percentile(samples, 50.0);
+  statistics.mad    = MedianAbsoluteDeviation(samples, statistics.median);
+  statistics.p95    = Percentile(samples, 95.0);
+
+  // A fixed seed, so that the same samples always give the same interval
+  std::mt19937        random(1u);
+  std::vector<double> medians(BOOTSTRAP_RESAMPLES);
+  for(double& median : medians)
+  {
+    median = ResampledMedian(samples, random);
+  }
+  std::sort(medians.begin(), medians.end());
+  statistics.ciLow  = Percentile(medians, 2.5);
+  statistics.ciHigh = Percentile(medians, 97.5);
+
+  return statistics;
+}
+
+SampleComparison CompareSamples(std::vector<double> a, std::vector<double> b)
+{
+  SampleComparison comparison;
+  if(a.empty() || b.empty())
+  {
+    return comparison;
+  }
+
+  RejectOutliers(a);
+  RejectOutliers(b);
+  comparison.difference = Median(b) - Median(a);
+
+  std::mt19937        random(1u);
+  std::vector<double> differences(BOOTSTRAP_RESAMPLES);
+  for(double& difference : differences)
+  {
+    difference = ResampledMedian(b, random) - ResampledMedian(a, random);
+  }
+  std::sort(differences.begin(), differences.end());
+  comparison.ciLow  = Percentile(differences, 2.5);
+  comparison.ciHigh = Percentile(differences, 97.5);
+
+  comparison.pValue      = MannWhitneyPValue(a, b);
+  comparison.significant = (comparison.ciLow > 0.0 || comparison.ciHigh < 0.0) && comparison.pValue < 0.05;
+  return comparison;
+}
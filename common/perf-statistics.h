@@ -0,0 +1,74 @@
+#ifndef PERF_STATISTICS_H
+#define PERF_STATISTICS_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <vector>
+
+// The number of resamples of the bootstrap confidence intervals
+#define BOOTSTRAP_RESAMPLES 2000u
+
+// The modified z-score above which a sample is rejected as an outlier
+#define OUTLIER_Z_SCORE 3.5
+
+/**
+ * @brief The robust statistics of the timings of repeated runs.
+ *
+ * The statistics are robust because the timings of a shared CI machine have a
+ * long tail: the samples whose modified z-score (based on the median absolute
+ * deviation) exceeds OUTLIER_Z_SCORE are rejected first.
+ */
+struct SampleStatistics {
+  size_t count = 0u;    ///< The number of samples kept
+  size_t outliers = 0u; ///< The number of samples rejected as outliers
+  double median = 0.0;  ///< The median of the samples kept
+  double mad = 0.0;     ///< The median absolute deviation, not scaled
+  double p95 = 0.0;     ///< The 95th percentile
+  double ciLow = 0.0;   ///< The 95% bootstrap confidence interval of the
+  double ciHigh = 0.0;  ///< median
+};
+
+/**
+ * @brief The comparison of the timings of two builds, B against A.
+ */
+struct SampleComparison {
+  double difference = 0.0;  ///< The median of B minus the median of A
+  double ciLow = 0.0;       ///< The 95% bootstrap confidence interval of the
+  double ciHigh = 0.0;      ///< difference of the medians
+  double pValue = 1.0;      ///< The two-sided p-value of the Mann-Whitney U test
+  bool significant = false; ///< Whether the interval excludes 0 and p < 0.05
+};
+
+/**
+ * @brief Compute the statistics of the given samples.
+ * @param[in] samples The samples, in any order
+ * @return The statistics, with a count of 0 if there are no samples
+ */
+SampleStatistics ComputeStatistics(std::vector<double> samples);
+
+/**
+ * @brief Compare two sets of samples. The outliers of each set are rejected
+ * first.
+ * @param[in] a The samples of the baseline build
+ * @param[in] b The samples of the build to compare with it
+ */
+SampleComparison CompareSamples(std::vector<double> a, std::vector<double> b);
+
+#endif // PERF_STATISTICS_H
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "repeat-runner.h"
+#include "perf-statistics.h"
+#include "startup-timeline.h"
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/devel-api/builder/json-parser.h>
+#include <dali-toolkit/devel-api/builder/tree-node.h>
+#include <sched.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+extern char** environ;
+
+using Dali::Toolkit::JsonParser;
+using Dali::Toolkit::TreeNode;
+
+namespace
+{
+// The options of the repeat runner, with the number of values they take, which are not passed to the runs
+const std::pair<const char*, int> REPEAT_OPTIONS[] = {
+  {"--repeat", 1},
+  {"--compare-with", 1},
+  {"--cpus", 1},
+  {"--results", 1},
+  {"--trace", 1},
+};
+
+double GetNumber(const TreeNode* node, double defaultValue)
+{
+  if(node && node->GetType() == TreeNode::INTEGER)
+  {
+    return node->GetInteger();
+  }
+  if(node && node->GetType() == TreeNode::FLOAT)
+  {
+    return node->GetFloat();
+  }
+  return defaultValue;
+}
+
+void PrintStatistics(const char* build, const char* what, const char* measure, const std::vector<double>& samples)
+{
+  const SampleStatistics statistics = ComputeStatistics(samples);
+  if(statistics.count == 0u)
+  {
+    return;
+  }
+  printf("STATS: %s %s %s median %.3f MAD %.3f p95 %.3f CI [%.3f, %.3f] n=%zu outliers=%zu\n", build, what, measure, statistics.median, statistics.mad, statistics.p95, statistics.ciLow, statistics.ciHigh, statistics.count, statistics.outliers);
+}
+
+void PrintComparison(const char* what, const char* measure, const std::vector<double>& a, const std::vector<double>& b)
+{
+  if(a.empty() || b.empty())
+  {
+    return;
+  }
+  const SampleComparison comparison = CompareSamples(a, b);
+  const double           medianA    = ComputeStatistics(a).median;
+  printf("COMPARE: %s %s A %.3f B %.3f difference %+.3f (%+.1f%%) CI [%.3f, %.3f] p=%.4f %s\n", what, measure, medianA, medianA + comparison.difference, comparison.difference, medianA > 0.0 ? 100.0 * comparison.difference / medianA : 0.0, comparison.ciLow, comparison.ciHigh, comparison.pValue, comparison.significant ? "significant" : "not significant");
+}
+} // namespace
+
+bool PinToCpus(const std::string& cpuList)
+{
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+
+  std::stringstream list(cpuList);
+  std::string       range;
+  while(std::getline(list, range, ','))
+  {
+    int first = -1, last = -1;
+    const int count = sscanf(range.c_str(), "%d-%d", &first, &last);
+    if(count < 1 || first < 0)
+    {
+      fprintf(stderr, "Invalid CPU list %s\n", cpuList.c_str());
+      return false;
+    }
+    for(int cpu = first; cpu <= (count == 2 ? last : first) && cpu < CPU_SETSIZE; ++cpu)
+    {
+      CPU_SET(cpu, &cpus);
+    }
+  }
+
+  if(sched_setaffinity(0, sizeof(cpus), &cpus) != 0)
+  {
+    fprintf(stderr, "Unable to pin the test to the CPUs %s: %s\n", cpuList.c_str(), strerror(errno));
+    return false;
+  }
+  return true;
+}
+
+RepeatRunner::RepeatRunner(int argc, char** argv)
+{
+  mExecutable = std::filesystem::read_symlink("/proc/self/exe").string();
+
+  for(int c = 1; c < argc;)
+  {
+    int skip = 0;
+    for(const auto& option : REPEAT_OPTIONS)
+    {
+      if(!strcmp(argv[c], option.first))
+      {
+        skip = 1 + option.second;
+      }
+    }
+
+    if(skip > 0)
+    {
+      c += skip;
+    }
+    else
+    {
+      mArguments.push_back(argv[c]);
+      ++c;
+    }
+  }
+}
+
+void RepeatRunner::SetBuildToCompare(const std::string& executable)
+{
+  mExecutableToCompare = executable;
+}
+
+int RepeatRunner::Run(int repeat)
+{
+  char directory[] = "/tmp/dali-repeat.XXXXXX";
+  if(!mkdtemp(directory))
+  {
+    fprintf(stderr, "Unable to create a directory for the results of the runs\n");
+    return 1;
+  }
+
+  Samples a, b;
+  for(int run = 1; run <= repeat; ++run)
+  {
+    RunOnce(mExecutable, std::string(directory) + "/a-" + std::to_string(run) + ".json", a);
+    if(!mExecutableToCompare.empty())
+    {
+      RunOnce(mExecutableToCompare, std::string(directory) + "/b-" + std::to_string(run) + ".json", b);
+    }
+  }
+  std::filesystem::remove_all(directory);
+
+  printf("REPEAT: %d run(s) of %s, %d failed\n", repeat, mExecutable.c_str(), a.failedRuns);
+  ReportStatistics("A", a);
+  if(!mExecutableToCompare.empty())
+  {
+    printf("REPEAT: %d run(s) of %s, %d failed\n", repeat, mExecutableToCompare.c_str(), b.failedRuns);
+    ReportStatistics("B", b);
+    ReportComparison(a, b);
+  }
+  fflush(stdout);
+
+  return (a.failedRuns > 0 || b.failedRuns > 0) ? 1 : 0;
+}
+
+void RepeatRunner::RunOnce(const std::string& executable, const std::string& resultsFile, Samples& samples)
+{
+  std::vector<char*> arguments;
+  arguments.push_back(const_cast<char*>(executable.c_str()));
+  for(auto& argument : mArguments)
+  {
+    arguments.push_back(const_cast<char*>(argument.c_str()));
+  }
+  const char* resultsOption = "--results";
+  arguments.push_back(const_cast<char*>(resultsOption));
+  arguments.push_back(const_cast<char*>(resultsFile.c_str()));
+  arguments.push_back(nullptr);
+
+  // Each run is given the time it is executed at, rather than the one this process was given
+  std::vector<std::string> variables;
+  for(char** variable = environ; *variable; ++variable)
+  {
+    if(strncmp(*variable, STARTUP_EXEC_TIME_ENV "=", strlen(STARTUP_EXEC_TIME_ENV) + 1) != 0)
+    {
+      variables.push_back(*variable);
+    }
+  }
+  variables.push_back(std::string(STARTUP_EXEC_TIME_ENV) + "=");
+  std::vector<char*> environment;
+
+  fflush(stdout);
+  const auto start = std::chrono::steady_clock::now();
+
+  variables.back() += std::to_string(GetStartupClockNs());
+  for(auto& variable : variables)
+  {
+    environment.push_back(const_cast<char*>(variable.c_str()));
+  }
+  environment.push_back(nullptr);
+
+  const pid_t child = fork();
+  if(child == 0)
+  {
+    execve(executable.c_str(), arguments.data(), environment.data());
+    fprintf(stderr, "Unable to run %s: %s\n", executable.c_str(), strerror(errno));
+    _exit(127);
+  }
+
+  int status = 0;
+  if(child < 0 || waitpid(child, &status, 0) != child)
+  {
+    ++samples.failedRuns;
+    return;
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  if(!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+  {
+    ++samples.failedRuns;
+  }
+  samples.wallTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+  ReadResults(resultsFile, samples);
+}
+
+void RepeatRunner::ReadResults(const std::string& resultsFile, Samples& samples)
+{
+  std::ifstream file(resultsFile);
+  if(!file)
+  {
+    return;
+  }
+  std::stringstream content;
+  content << file.rdbuf();
+
+  JsonParser parser = JsonParser::New();
+  if(!parser.Parse(content.str()) || !parser.GetRoot())
+  {
+    return;
+  }
+
+  const TreeNode* steps = parser.GetRoot()->GetChild("steps");
+  if(!steps)
+  {
+    return;
+  }
+
+  // Only the comparisons which count, a retried capture is superseded by the next one
+  for(auto iter = steps->CBegin(); iter != steps->CEnd(); ++iter)
+  {
+    const TreeNode& step    = (*iter).second;
+    const TreeNode* retried = step.GetChild("retried");
+    if(retried && retried->GetType() == TreeNode::BOOLEAN && retried->GetBoolean())
+    {
+      continue;
+    }
+
+    const int index = static_cast<int>(GetNumber(step.GetChild("index"), 0.0));
+    if(const TreeNode* name = step.GetChild("name"))
+    {
+      samples.stepNames[index] = name->GetString();
+    }
+
+    const double duration = GetNumber(step.GetChild("durationMs"), -1.0);
+    const double frame    = GetNumber(step.GetChild("frameMs"), -1.0);
+    if(duration >= 0.0)
+    {
+      samples.durations[index].push_back(duration);
+    }
+    if(frame >= 0.0)
+    {
+      samples.frames[index].push_back(frame);
+    }
+  }
+}
+
+void RepeatRunner::ReportStatistics(const char* build, const Samples& samples) const
+{
+  PrintStatistics(build, "run", "wallMs", samples.wallTimes);
+  for(const auto& step : samples.stepNames)
+  {
+    const std::string what = "step " + std::to_string(step.first) + " (" + step.second + ")";
+    if(samples.durations.count(step.first))
+    {
+      PrintStatistics(build, what.c_str(), "durationMs", samples.durations.at(step.first));
+    }
+    if(samples.frames.count(step.first))
+    {
+      PrintStatistics(build, what.c_str(), "frameMs", samples.frames.at(step.first));
+    }
+  }
+}
+
+void RepeatRunner::ReportComparison(const Samples& a, const Samples& b) const
+{
+  PrintComparison("run", "wallMs", a.wallTimes, b.wallTimes);
+  for(const auto& step : a.stepNames)
+  {
+    const std::string what = "step " + std::to_string(step.first) + " (" + step.second + ")";
+    if(a.durations.count(step.first) && b.durations.count(step.first))
+    {
+      PrintComparison(what.c_str(), "durationMs", a.durations.at(step.first), b.durations.at(step.first));
+    }
+    if(a.frames.count(step.first) && b.frames.count(step.first))
+    {
+      PrintComparison(what.c_str(), "frameMs", a.frames.at(step.first), b.frames.at(step.first));
+    }
+  }
+}
@@ -0,0 +1,104 @@
+#ifndef REPEAT_RUNNER_H
+#define REPEAT_RUNNER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Pin the process, and the threads it creates afterwards, to the given
+ * CPUs with sched_setaffinity.
+ * @param[in] cpuList The CPUs, e.g. "2,3" or "4-7"
+ * @return Whether the affinity has been set
+ */
+bool PinToCpus(const std::string &cpuList);
+
+/**
+ * @brief Runs a visual test several times and reports the statistics of its
+ * timings, i.e. --repeat.
+ *
+ * Each run is a child process of the test executable with the same options,
+ * writing its results to a file of its own. The duration and the frame time
+ * of every step, and the wall time of the runs, are then reported as STATS:
+ * lines (see ComputeStatistics).
+ *
+ * With a build to compare with (--compare-with), the runs of the two builds
+ * are interleaved so that both see the same drift of the machine, and the
+ * difference of every measure is reported as a COMPARE: line, which says
+ * whether it is significant.
+ */
+class RepeatRunner {
+public:
+  /**
+   * @brief Constructor.
+   * @param[in] argc The number of arguments of the test executable
+   * @param[in] argv The arguments of the test executable, the options of the
+   * repeat runner are not passed to the runs
+   */
+  RepeatRunner(int argc, char **argv);
+
+  /**
+   * @brief Set the test executable of another build to compare with.
+   * @param[in] executable The test executable of the other build
+   */
+  void SetBuildToCompare(const std::string &executable);
+
+  /**
+   * @brief Run the test and report the statistics.
+   * @param[in] repeat The number of runs of each build
+   * @return The exit value of the test executable: 0 if all the runs have
+   * passed, otherwise 1
+   */
+  int Run(int repeat);
+
+private:
+  /**
+   * @brief The samples of one build.
+   */
+  struct Samples {
+    std::map<int, std::string> stepNames;
+    std::map<int, std::vector<double>> durations; ///< By step index
+    std::map<int, std::vector<double>> frames;    ///< By step index
+    std::vector<double> wallTimes;
+    int failedRuns = 0;
+  };
+
+  /**
+   * @brief Run the given executable once and add its measures to the samples.
+   */
+  void RunOnce(const std::string &executable, const std::string &resultsFile,
+               Samples &samples);
+
+  /**
+   * @brief Read the measures of a run from its results file.
+   */
+  void ReadResults(const std::string &resultsFile, Samples &samples);
+
+  void ReportStatistics(const char *build, const Samples &samples) const;
+  void ReportComparison(const Samples &a, const Samples &b) const;
+
+private:
+  std::string mExecutable;
+  std::string mExecutableToCompare;
+  std::vector<std::string> mArguments; ///< The arguments passed to the runs
+};
+
+#endif // REPEAT_RUNNER_H
@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "scene-loader.h"
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/devel-api/image-loader/texture-manager.h>
+#include <dali/devel-api/rendering/frame-buffer-devel.h>
+#include <dali/integration-api/string-utils.h>
+#include <chrono>
+#include <cmath>
+#include <map>
+
+// INTERNAL INCLUDES
+#include "allocation-counter.h"
+#include "memory-sampler.h"
+#include "shader-cache.h"
+#include "test-paths.h"
+#include "thread-pool.h"
+#include "trace.h"
+
+using namespace Dali;
+using namespace Dali::Scene3D::Loader;
+
+using Dali::Integration::ToDaliString;
+
+namespace
+{
+const char* STAGE_NAMES[SCENE_LOAD_STAGE_COUNT] = {
+  "load-model",
+  "count-resource-refs",
+  "load-resources",
+  "create-nodes",
+  "configure-skinning",
+  "configure-blendshapes",
+  "apply-constraints",
+};
+
+const Vector3 CAMERA_DEFAULT_POSITION(0.0f, 0.0f, 3.5f);
+
+double Milliseconds(TraceClock::duration duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+/**
+ * @brief Add the time and the allocations of a stage to the profile, from its
+ * construction to its destruction. A stage run for several roots adds up.
+ */
+class StageTimer
+{
+public:
+  StageTimer(SceneLoadStage stage, const std::string& sceneName, SceneLoadProfile& profile)
+  : mStage(stage),
+    mSceneName(sceneName),
+    mProfile(profile),
+    mAllocations(GetThreadAllocationCount()),
+    mStart(TraceClock::now())
+  {
+  }
+
+  ~StageTimer()
+  {
+    const TraceClock::time_point end = TraceClock::now();
+    mProfile.stageMs[mStage] += Milliseconds(end - mStart);
+    mProfile.allocations[mStage] += GetThreadAllocationCount() - mAllocations;
+    TraceSpan(STAGE_NAMES[mStage], mStart, end, 0, mSceneName);
+  }
+
+private:
+  SceneLoadStage         mStage;
+  const std::string&     mSceneName;
+  SceneLoadProfile&      mProfile;
+  uint64_t               mAllocations;
+  TraceClock::time_point mStart;
+};
+
+// The ShaderManager of all the scenes, see GetSharedShaderManager
+ShaderManagerPtr gSharedShaderManager;
+
+// The textures of the environment maps created so far, by their cube maps, see CreateTestScene
+std::map<std::string, EnvironmentDefinition::Textures> gEnvironmentTextures;
+
+std::string GetEnvironmentKey(const EnvironmentDefinition& environment)
+{
+  return environment.mDiffuseMapPath + '\n' + environment.mSpecularMapPath + (environment.mUseBrdfTexture ? "\nbrdf" : "");
+}
+
+/**
+ * @brief Generate the resources of a scene decoded, but for the environment
+ * maps whose textures have been created for a previous scene, which are given
+ * those instead. The textures of the others are kept for the next scenes.
+ */
+void GenerateSceneResources(ResourceBundle& resources)
+{
+  // The environment maps reused, with their reference counts
+  std::vector<std::pair<uint32_t, uint32_t>> reused;
+
+  auto& refCounts = resources.mReferenceCounts[ResourceType::Environment];
+  for(uint32_t i = 0u; i < resources.mEnvironmentMaps.size() && i < refCounts.Size(); ++i)
+  {
+    const EnvironmentDefinition& environment = resources.mEnvironmentMaps[i].first;
+    if(refCounts[i] > 0u && gEnvironmentTextures.count(GetEnvironmentKey(environment)))
+    {
+      reused.push_back({i, refCounts[i]});
+      refCounts[i] = 0u; // Not created again
+    }
+  }
+
+  resources.GenerateResources();
+
+  for(const auto& environment : reused)
+  {
+    auto& environmentMap         = resources.mEnvironmentMaps[environment.first];
+    environmentMap.second        = gEnvironmentTextures[GetEnvironmentKey(environmentMap.first)];
+    refCounts[environment.first] = environment.second;
+  }
+  for(uint32_t i = 0u; i < resources.mEnvironmentMaps.size() && i < refCounts.Size(); ++i)
+  {
+    const auto& environmentMap = resources.mEnvironmentMaps[i];
+    const bool  hasCubeMaps    = !environmentMap.first.mDiffuseMapPath.empty() || !environmentMap.first.mSpecularMapPath.empty();
+    if(refCounts[i] > 0u && hasCubeMaps && environmentMap.second.IsLoaded())
+    {
+      gEnvironmentTextures.emplace(GetEnvironmentKey(environmentMap.first), environmentMap.second);
+    }
+  }
+}
+
+/**
+ * @brief Get the workers which decode the scenes, one per CPU.
+ */
+ThreadPool& GetDecoderPool()
+{
+  static ThreadPool pool(GetAvailableCpuCount());
+  return pool;
+}
+
+/**
+ * @brief Configure the camera from the first camera of the scene, or in front
+ * of the scene if it has none.
+ * @return The view and projection of the camera
+ */
+ViewProjection ConfigureCamera(std::vector<CameraParameters>& cameraParameters, CameraActor camera)
+{
+  if(cameraParameters.empty())
+  {
+    cameraParameters.push_back(CameraParameters());
+    cameraParameters[0].matrix.SetTranslation(CAMERA_DEFAULT_POSITION);
+  }
+
+  cameraParameters[0].ConfigureCamera(camera);
+  SetActorCentered(camera);
+  return cameraParameters[0].GetViewProjection();
+}
+
+/**
+ * @brief Create the actors of a root whose resources are loaded, from
+ * SCENE_CREATE_NODES to SCENE_APPLY_CONSTRAINTS.
+ * @return The actor of the root, or an empty handle
+ */
+Actor CreateRoot(SceneDefinition& scene, ResourceBundle& resources, uint32_t root, NodeDefinition::CreateParams& nodeParams, const std::string& sceneName, SceneLoadProfile& profile)
+{
+  Customization::Choices choices;
+
+  Actor actor;
+  {
+    StageTimer timer(SCENE_CREATE_NODES, sceneName, profile);
+    actor = scene.CreateNodes(root, choices, nodeParams);
+  }
+  if(!actor)
+  {
+    return actor;
+  }
+
+  {
+    StageTimer timer(SCENE_CONFIGURE_SKINNING, sceneName, profile);
+    scene.ConfigureSkinningShaders(resources, actor, std::move(nodeParams.mSkinnables));
+  }
+  {
+    StageTimer timer(SCENE_CONFIGURE_BLENDSHAPES, sceneName, profile);
+    DALI_ASSERT_ALWAYS(scene.ConfigureBlendshapeShaders(resources, actor, std::move(nodeParams.mBlendshapeRequests)));
+  }
+  {
+    StageTimer timer(SCENE_APPLY_CONSTRAINTS, sceneName, profile);
+    scene.ApplyConstraints(actor, std::move(nodeParams.mConstrainables));
+  }
+  return actor;
+}
+} // namespace
+
+const char* GetSceneLoadStageName(SceneLoadStage stage)
+{
+  return STAGE_NAMES[stage];
+}
+
+ResourceBundle::PathProvider GetTestScenePathProvider()
+{
+  static const std::string RESOURCE_TYPE_DIRS[]{
+    TestScenePath("environments/"),
+    TestScenePath("shaders/"),
+    TestScenePath("models/"),
+    TestScenePath("images/"),
+  };
+
+  return [](ResourceType::Value type) { return RESOURCE_TYPE_DIRS[type]; };
+}
+
+LoadedScene LoadTestScene(const std::string& sceneName, CameraActor camera, SceneLoadProfile* profile)
+{
+  SceneLoadProfile             loadProfile;
+  const TraceClock::time_point loadStart = TraceClock::now();
+
+  ResourceBundle::PathProvider pathProvider = GetTestScenePathProvider();
+  const std::string            modelsDir    = pathProvider(ResourceType::Mesh);
+
+  LoadedScene                           loaded;
+  ResourceBundle                        resources;
+  SceneDefinition                       scene;
+  SceneMetadata                         metaData;
+  std::vector<AnimationGroupDefinition> animGroups;
+  std::vector<CameraParameters>         cameraParameters;
+  std::vector<LightParameters>          lights;
+
+  LoadResult output{resources, scene, metaData, loaded.animations, animGroups, cameraParameters, lights};
+
+  {
+    StageTimer  timer(SCENE_LOAD_MODEL, sceneName, loadProfile);
+    ModelLoader modelLoader(ToDaliString(modelsDir + sceneName), ToDaliString(modelsDir + "/"), output);
+    modelLoader.LoadModel(pathProvider);
+  }
+
+  ViewProjection               viewProjection = ConfigureCamera(cameraParameters, camera);
+  Transforms                   xforms{MatrixStack{}, viewProjection};
+  NodeDefinition::CreateParams nodeParams{resources, xforms, GetSharedShaderManager(), {}, {}, {}};
+  Customization::Choices       choices;
+
+  loaded.root = Actor::New();
+  SetActorCentered(loaded.root);
+
+  for(auto root : scene.GetRoots())
+  {
+    {
+      StageTimer timer(SCENE_COUNT_RESOURCE_REFS, sceneName, loadProfile);
+      auto       resourceRefs = resources.CreateRefCounter();
+      scene.CountResourceRefs(root, choices, resourceRefs);
+      resources.mReferenceCounts = std::move(resourceRefs);
+      resources.CountEnvironmentReferences();
+    }
+    {
+      StageTimer timer(SCENE_LOAD_RESOURCES, sceneName, loadProfile);
+      resources.LoadResources(pathProvider);
+    }
+
+    if(Actor actor = CreateRoot(scene, resources, root, nodeParams, sceneName, loadProfile))
+    {
+      loaded.root.Add(actor);
+    }
+  }
+  RecordShaderPrograms(loaded.root);
+
+  if(profile)
+  {
+    loadProfile.totalMs   = Milliseconds(TraceClock::now() - loadStart);
+    loadProfile.peakRssKb = GetPeakRss();
+    *profile              = loadProfile;
+  }
+  return loaded;
+}
+
+std::unique_ptr<DecodedScene> DecodeTestScene(const std::string& sceneName)
+{
+  const TraceClock::time_point decodeStart = TraceClock::now();
+
+  ResourceBundle::PathProvider pathProvider = GetTestScenePathProvider();
+  const std::string            modelsDir    = pathProvider(ResourceType::Mesh);
+
+  auto decoded  = std::make_unique<DecodedScene>();
+  decoded->name = sceneName;
+
+  LoadResult output{decoded->resources, decoded->scene, decoded->metaData, decoded->animations, decoded->animGroups, decoded->cameraParameters, decoded->lights};
+
+  {
+    // Only the raw resources, which are decoded without creating any DALi object
+    StageTimer  timer(SCENE_LOAD_MODEL, sceneName, decoded->profile);
+    ModelLoader modelLoader(ToDaliString(modelsDir + sceneName), ToDaliString(modelsDir + "/"), output);
+    modelLoader.LoadModel(pathProvider, true);
+  }
+
+  {
+    // The references of all the roots at once, so that the resources are created in one go
+    StageTimer             timer(SCENE_COUNT_RESOURCE_REFS, sceneName, decoded->profile);
+    Customization::Choices choices;
+    auto                   resourceRefs = decoded->resources.CreateRefCounter();
+    for(auto root : decoded->scene.GetRoots())
+    {
+      decoded->scene.CountResourceRefs(root, choices, resourceRefs);
+    }
+    decoded->resources.mReferenceCounts = std::move(resourceRefs);
+    decoded->resources.CountEnvironmentReferences();
+  }
+
+  decoded->profile.totalMs = Milliseconds(TraceClock::now() - decodeStart);
+  return decoded;
+}
+
+std::future<std::unique_ptr<DecodedScene>> DecodeTestSceneAsync(const std::string& sceneName)
+{
+  return GetDecoderPool().Submit([sceneName]() { return DecodeTestScene(sceneName); });
+}
+
+LoadedScene CreateTestScene(DecodedScene& decoded, CameraActor camera, SceneLoadProfile* profile)
+{
+  SceneLoadProfile             loadProfile = decoded.profile;
+  const TraceClock::time_point createStart = TraceClock::now();
+
+  if(!decoded.generated)
+  {
+    StageTimer timer(SCENE_LOAD_RESOURCES, decoded.name, loadProfile);
+    GenerateSceneResources(decoded.resources);
+    decoded.generated = true;
+  }
+
+  ViewProjection               viewProjection = ConfigureCamera(decoded.cameraParameters, camera);
+  Transforms                   xforms{MatrixStack{}, viewProjection};
+  NodeDefinition::CreateParams nodeParams{decoded.resources, xforms, GetSharedShaderManager(), {}, {}, {}};
+
+  LoadedScene loaded;
+  loaded.root       = Actor::New();
+  loaded.animations = decoded.animations;
+  SetActorCentered(loaded.root);
+
+  for(auto root : decoded.scene.GetRoots())
+  {
+    if(Actor actor = CreateRoot(decoded.scene, decoded.resources, root, nodeParams, decoded.name, loadProfile))
+    {
+      loaded.root.Add(actor);
+    }
+  }
+
+  if(profile)
+  {
+    loadProfile.totalMs += Milliseconds(TraceClock::now() - createStart);
+    loadProfile.peakRssKb  = GetPeakRss();
+    *profile               = loadProfile;
+  }
+
+  // The other instances of the scene share the programs of the first one
+  if(!decoded.programsRecorded)
+  {
+    RecordShaderPrograms(loaded.root);
+    decoded.programsRecorded = true;
+  }
+  return loaded;
+}
+
+ShaderManagerPtr GetSharedShaderManager()
+{
+  if(!gSharedShaderManager)
+  {
+    gSharedShaderManager = new ShaderManager();
+  }
+  return gSharedShaderManager;
+}
+
+void ReleaseSharedSceneResources()
+{
+  gSharedShaderManager.Reset();
+  gEnvironmentTextures.clear();
+}
+
+Layer CreateSceneLayer(Window window, CameraActor camera)
+{
+  Layer layer = Layer::New();
+  layer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  layer.SetProperty(Actor::Property::PIVOT, Pivot::CENTER);
+  layer.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+  layer[Layer::Property::BEHAVIOR] = Layer::LAYER_3D;
+  window.Add(layer);
+
+  layer.Add(camera);
+  return layer;
+}
+
+RenderTask CreateSceneRenderTask(Window window, Layer layer, CameraActor camera, Vector2 size, bool offscreen)
+{
+  RenderTask task = window.GetRenderTaskList().CreateTask();
+  task.SetCameraActor(camera);
+  task.SetSourceActor(layer);
+  task.SetClearColor(Color::WHITE);
+  task.SetClearEnabled(true);
+  task.SetRefreshRate(RenderTask::REFRESH_ALWAYS);
+  task.SetExclusive(true);
+
+  if(offscreen)
+  {
+    const uint32_t width  = static_cast<uint32_t>(size.width);
+    const uint32_t height = static_cast<uint32_t>(size.height);
+
+    FrameBuffer frameBuffer  = FrameBuffer::New(width, height, FrameBuffer::Attachment::COLOR_DEPTH);
+    Texture     depthTexture = Texture::New(TextureType::TEXTURE_2D, Pixel::DEPTH_FLOAT, width, height);
+    DevelFrameBuffer::AttachDepthTexture(frameBuffer, depthTexture);
+    task.SetFrameBuffer(frameBuffer);
+  }
+  else
+  {
+    const Window::WindowSize windowSize = window.GetSize();
+    task.SetViewportPosition(Vector2((windowSize.GetWidth() - size.width) / 2, (windowSize.GetHeight() - size.height) / 2));
+    task.SetViewportSize(size);
+  }
+  return task;
+}
+
+Toolkit::ImageView CreateSceneImageView(Window window, RenderTask task, Vector2 size, std::string* url)
+{
+  const std::string textureUrl = Toolkit::TextureManager::AddTexture(task.GetFrameBuffer().GetColorTexture());
+  if(url)
+  {
+    *url = textureUrl;
+  }
+
+  Toolkit::ImageView image = Toolkit::ImageView::New(textureUrl);
+  image[Actor::Property::PARENT_ORIGIN] = ParentOrigin::CENTER;
+  image[Actor::Property::PIVOT]         = Pivot::CENTER;
+  image[Actor::Property::SIZE]          = size;
+  image[Actor::Property::SCALE_Y]       = -1; // Invert the image
+  window.Add(image);
+  return image;
+}
+
+void SetSceneGridCell(Actor root, int index, int count)
+{
+  const int   columns = static_cast<int>(std::ceil(std::sqrt(count)));
+  const float cell    = 1.0f / columns;
+  root[Actor::Property::SCALE]    = Vector3(cell, cell, cell);
+  root[Actor::Property::POSITION] = Vector3((index % columns + 0.5f) * cell - 0.5f, (index / columns + 0.5f) * cell - 0.5f, 0.0f);
+}
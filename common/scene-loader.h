@@ -0,0 +1,223 @@
+#ifndef SCENE_LOADER_H
+#define SCENE_LOADER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-scene3d/dali-scene3d.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/dali.h>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The stages of the loading of a scene, in order.
+ */
+enum SceneLoadStage {
+  SCENE_LOAD_MODEL,            ///< ModelLoader::LoadModel, parsing and decoding
+  SCENE_COUNT_RESOURCE_REFS,   ///< Counting the resources used by the roots
+  SCENE_LOAD_RESOURCES,        ///< Creating the meshes, textures and shaders
+  SCENE_CREATE_NODES,          ///< Creating the actors of the nodes
+  SCENE_CONFIGURE_SKINNING,    ///< Configuring the skinning shaders
+  SCENE_CONFIGURE_BLENDSHAPES, ///< Configuring the blend shape shaders
+  SCENE_APPLY_CONSTRAINTS,     ///< Applying the constraints of the nodes
+  SCENE_LOAD_STAGE_COUNT
+};
+
+/**
+ * @brief The cost of the loading of a scene, stage by stage.
+ */
+struct SceneLoadProfile {
+  double stageMs[SCENE_LOAD_STAGE_COUNT] = {};       ///< The time of each stage
+  uint64_t allocations[SCENE_LOAD_STAGE_COUNT] = {}; ///< The allocations made
+  double totalMs = 0.0;    ///< The time of the whole load
+  uint64_t peakRssKb = 0u; ///< The peak resident set size after the load
+};
+
+/**
+ * @brief A scene loaded into actors.
+ */
+struct LoadedScene {
+  Dali::Actor root; ///< The actor of the scene, with the roots as children
+  std::vector<Dali::Scene3D::Loader::AnimationDefinition> animations;
+};
+
+/**
+ * @brief A scene parsed and decoded, whose DALi objects are not created yet.
+ *
+ * The scene is loaded by ModelLoader with the raw resources only, i.e. the
+ * pixels of the textures and the vertices of the meshes are decoded but not
+ * uploaded, so it can be decoded on any thread (see CreateTestScene).
+ */
+struct DecodedScene {
+  std::string name; ///< The file of the scene in the models directory
+  Dali::Scene3D::Loader::ResourceBundle resources;
+  Dali::Scene3D::Loader::SceneDefinition scene;
+  Dali::Scene3D::Loader::SceneMetadata metaData;
+  std::vector<Dali::Scene3D::Loader::AnimationDefinition> animations;
+  std::vector<Dali::Scene3D::Loader::AnimationGroupDefinition> animGroups;
+  std::vector<Dali::Scene3D::Loader::CameraParameters> cameraParameters;
+  std::vector<Dali::Scene3D::Loader::LightParameters> lights;
+  SceneLoadProfile profile;      ///< The cost of the decoding so far
+  bool generated = false;        ///< Whether the DALi resources are created
+  bool programsRecorded = false; ///< Whether the shader programs are recorded
+};
+
+/**
+ * @brief Get the name of a stage, e.g. "load-model".
+ */
+const char *GetSceneLoadStageName(SceneLoadStage stage);
+
+/**
+ * @brief Get the directories of the resources of the test scenes, i.e. the
+ * environments, shaders, models and images of TestScenePath().
+ */
+Dali::Scene3D::Loader::ResourceBundle::PathProvider GetTestScenePathProvider();
+
+/**
+ * @brief Load a scene of the test scenes on the calling thread.
+ *
+ * The stages are those of Scene3D::Loader for each root of the scene (see
+ * SceneLoadStage), one root after the other. This is the serial path, see
+ * DecodeTestSceneAsync for the parallel one. Each stage is also a span of
+ * the trace (see TraceSpan). The allocations are those of the calling thread
+ * (see GetThreadAllocationCount), and the peak resident set size is that of
+ * the step of the test, which is reset when the step begins.
+ *
+ * @param[in] sceneName The file of the scene in the models directory, e.g.
+ * "exercise.dli"
+ * @param[in] camera The camera, configured from the first camera of the scene
+ * or placed in front of the scene if it has none
+ * @param[out] profile The cost of the load, or nullptr
+ * @return The scene loaded
+ */
+LoadedScene LoadTestScene(const std::string &sceneName,
+                          Dali::CameraActor camera,
+                          SceneLoadProfile *profile = nullptr);
+
+/**
+ * @brief Parse a scene of the test scenes, count the references of all its
+ * roots and decode their resources, i.e. the stages up to
+ * SCENE_COUNT_RESOURCE_REFS. It can be called from any thread.
+ * @param[in] sceneName The file of the scene in the models directory
+ * @return The scene decoded
+ */
+std::unique_ptr<DecodedScene> DecodeTestScene(const std::string &sceneName);
+
+/**
+ * @brief Decode a scene on the workers of the loader, so that the scenes of a
+ * test are decoded in parallel with each other and with the event thread.
+ *
+ * The allocations of the workers are not those of the event thread, they are
+ * counted in the profile of the scene all the same.
+ *
+ * @param[in] sceneName The file of the scene in the models directory
+ * @return The future of the scene decoded
+ */
+std::future<std::unique_ptr<DecodedScene>>
+DecodeTestSceneAsync(const std::string &sceneName);
+
+/**
+ * @brief Create the resources and the actors of a scene decoded, i.e. the
+ * stages from SCENE_LOAD_RESOURCES. It must be called on the event thread.
+ *
+ * It can be called again for the same scene to create another instance of
+ * it, which shares the textures, the meshes and the shaders of the first.
+ * The textures of the environment maps are created once per process: those of
+ * the cube maps of a previous scene are given to the next scenes instead. The
+ * cube maps are still decoded by ModelLoader, but not uploaded again.
+ * @param[in] decoded The scene decoded
+ * @param[in] camera The camera, configured as by LoadTestScene
+ * @param[out] profile The cost of the decoding and of the creation, or nullptr
+ * @return The scene loaded
+ */
+LoadedScene CreateTestScene(DecodedScene &decoded, Dali::CameraActor camera,
+                            SceneLoadProfile *profile = nullptr);
+
+/**
+ * @brief Get the ShaderManager shared by all the scenes loaded, so that the
+ * shaders of a scene are generated and compiled once per process rather than
+ * once per load. It must be called on the event thread.
+ */
+Dali::Scene3D::Loader::ShaderManagerPtr GetSharedShaderManager();
+
+/**
+ * @brief Release the shared ShaderManager and its shaders, and the textures
+ * of the environment maps kept by CreateTestScene, before DALi is terminated.
+ */
+void ReleaseSharedSceneResources();
+
+/**
+ * @brief Create the 3D layer of the scenes, filling the window, and add the
+ * camera of the scenes to it.
+ * @param[in] window The window the layer is added to
+ * @param[in] camera The camera of the scenes, e.g. given to CreateTestScene
+ * @return The layer, to which the scenes are added
+ */
+Dali::Layer CreateSceneLayer(Dali::Window window, Dali::CameraActor camera);
+
+/**
+ * @brief Create the render task of the scenes of a layer, as the scene3d test
+ * renders them: an exclusive task which clears to white and renders every
+ * frame.
+ *
+ * Offscreen, the scenes are rendered to a framebuffer of the given size with
+ * a depth texture, whose color texture the test draws (see
+ * RenderTask::GetFrameBuffer). Otherwise they are rendered straight into the
+ * window, in a viewport of the given size at its center.
+ *
+ * @param[in] window The window of the layer
+ * @param[in] layer The layer of the scenes, see CreateSceneLayer
+ * @param[in] camera The camera of the scenes
+ * @param[in] size The size of the render
+ * @param[in] offscreen Whether the scenes are rendered to a framebuffer
+ * @return The render task, which the test removes from the window when done
+ */
+Dali::RenderTask CreateSceneRenderTask(Dali::Window window, Dali::Layer layer,
+                                       Dali::CameraActor camera,
+                                       Dali::Vector2 size, bool offscreen);
+
+/**
+ * @brief Draw the framebuffer of an offscreen render task of the scenes at the
+ * center of the window. The image is flipped, since the framebuffer is upside
+ * down compared to the loaded images.
+ * @param[in] window The window of the render task
+ * @param[in] task The render task, see CreateSceneRenderTask
+ * @param[in] size The size of the image
+ * @param[out] url The URL of the color texture given to the TextureManager,
+ * which the test removes with the image, or nullptr
+ * @return The image, added to the window
+ */
+Dali::Toolkit::ImageView CreateSceneImageView(Dali::Window window,
+                                              Dali::RenderTask task,
+                                              Dali::Vector2 size,
+                                              std::string *url = nullptr);
+
+/**
+ * @brief Place an instance of a scene in a cell of a square grid, which fills
+ * the space of one scene, e.g. for the instances sharing one decoded scene.
+ * @param[in] root The root of the instance, see LoadedScene
+ * @param[in] index The cell of the instance, from 0 and row by row
+ * @param[in] count The number of instances in the grid
+ */
+void SetSceneGridCell(Dali::Actor root, int index, int count);
+
+#endif // SCENE_LOADER_H
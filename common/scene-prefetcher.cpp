@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "scene-prefetcher.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <chrono>
+
+// INTERNAL INCLUDES
+#include "trace.h"
+
+ScenePrefetcher::ScenePrefetcher(std::vector<std::string> scenes, size_t lookahead)
+: mScenes(std::move(scenes)),
+  mLookahead(std::max<size_t>(lookahead, 1u))
+{
+  // The scene of the first step, and the lookahead after it
+  Prefetch(mLookahead + 1u);
+}
+
+bool ScenePrefetcher::HasNext() const
+{
+  return !mPending.empty();
+}
+
+std::unique_ptr<DecodedScene> ScenePrefetcher::TakeNext()
+{
+  if(mPending.empty())
+  {
+    return nullptr;
+  }
+
+  const TraceClock::time_point  waitStart = TraceClock::now();
+  std::unique_ptr<DecodedScene> decoded   = mPending.front().get();
+  const TraceClock::time_point  waitEnd   = TraceClock::now();
+  mPending.pop_front();
+  TraceSpan("prefetch-wait", waitStart, waitEnd, 0, decoded->name);
+
+  // The next scenes are decoded while this one is created and its step runs
+  Prefetch(mLookahead);
+
+  const double waitMs = std::chrono::duration<double, std::milli>(waitEnd - waitStart).count();
+  ++mStats.sceneCount;
+  mStats.decodeMs += decoded->profile.totalMs;
+  mStats.waitMs += waitMs;
+  mStats.savedMs += std::max(decoded->profile.totalMs - waitMs, 0.0);
+  return decoded;
+}
+
+const ScenePrefetchStats& ScenePrefetcher::GetStats() const
+{
+  return mStats;
+}
+
+void ScenePrefetcher::Prefetch(size_t count)
+{
+  while(mNextDecode < mScenes.size() && mPending.size() < count)
+  {
+    mPending.push_back(DecodeTestSceneAsync(mScenes[mNextDecode++]));
+  }
+}
@@ -0,0 +1,98 @@
+#ifndef SCENE_PREFETCHER_H
+#define SCENE_PREFETCHER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "scene-loader.h"
+
+/**
+ * @brief The wall time saved by the prefetching of the scenes of a test.
+ */
+struct ScenePrefetchStats {
+  uint32_t sceneCount = 0u; ///< The scenes taken so far
+  double decodeMs = 0.0;    ///< The time to decode them, on the workers
+  double waitMs = 0.0;      ///< The time the event thread waited for them
+  double savedMs = 0.0;     ///< The decoding done while the steps ran
+};
+
+/**
+ * @brief Decode the scenes of the steps of a test ahead of the steps.
+ *
+ * The steps of the scene tests load a scene, render it and compare the
+ * capture with the expected image. The prefetcher decodes the scene of the
+ * next step on the workers of the loader (see DecodeTestSceneAsync) while the
+ * current step renders and compares, so that only the creation of the
+ * resources and of the actors (see CreateTestScene) is left at the start of
+ * the step. At most lookahead scenes are decoded ahead of the one taken, so
+ * the decoded scenes do not all stay in memory at once.
+ *
+ * The saved wall time is the time to decode the scenes taken, less the time
+ * the event thread waited for them. It must be used on the event thread.
+ */
+class ScenePrefetcher {
+public:
+  /**
+   * @brief Constructor. Starts decoding the first scene and those after it.
+   * @param[in] scenes The files of the scenes of the steps, in order
+   * @param[in] lookahead The number of scenes decoded ahead, at least 1
+   */
+  explicit ScenePrefetcher(std::vector<std::string> scenes,
+                           size_t lookahead = 1u);
+
+  /**
+   * @brief Whether there is a scene left to take.
+   */
+  bool HasNext() const;
+
+  /**
+   * @brief Take the scene of the next step, waiting for it if it is still
+   * being decoded, and start decoding the scene after the lookahead.
+   * @return The scene decoded, or nullptr if all the scenes have been taken
+   */
+  std::unique_ptr<DecodedScene> TakeNext();
+
+  /**
+   * @brief Get the time saved by the scenes taken so far.
+   */
+  const ScenePrefetchStats &GetStats() const;
+
+private:
+  /**
+   * @brief Start decoding the next scenes, until count of them are pending.
+   */
+  void Prefetch(size_t count);
+
+private:
+  std::vector<std::string> mScenes;
+  size_t mLookahead;
+  size_t mNextDecode = 0u; ///< The next scene to start decoding
+  std::deque<std::future<std::unique_ptr<DecodedScene>>> mPending;
+  ScenePrefetchStats mStats;
+};
+
+#endif // SCENE_PREFETCHER_H
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "shader-cache.h"
+
+// EXTERNAL INCLUDES
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <unordered_set>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "test-paths.h"
+
+using namespace Dali;
+namespace fs = std::filesystem;
+
+namespace
+{
+std::string                  gShaderCacheDir; // Empty if the cache is disabled
+std::unordered_set<uint64_t> gCachedPrograms; // The programs of the index
+std::unordered_set<uint64_t> gSeenPrograms;   // The programs recorded by this run
+std::vector<uint64_t>        gNewPrograms;    // The programs missing from the index
+ShaderCacheCounts            gShaderCacheCounts;
+uint64_t                     gDriverFiles = 0u; // The files of the driver cache at the start
+uint64_t                     gDriverBytes = 0u; // The bytes of the driver cache at the start
+
+/**
+ * @brief Get the 64 bit FNV-1a hash of the sources of a program.
+ */
+uint64_t HashProgram(const std::string& vertex, const std::string& fragment)
+{
+  uint64_t hash = 14695981039346656037ull;
+  for(const std::string* source : {&vertex, &fragment})
+  {
+    for(unsigned char character : *source)
+    {
+      hash = (hash ^ character) * 1099511628211ull;
+    }
+    hash *= 1099511628211ull; // A null separator, so that "ab" + "c" is not "a" + "bc"
+  }
+  return hash;
+}
+
+void LoadIndex()
+{
+  FILE* file = fopen((gShaderCacheDir + "/" SHADER_CACHE_INDEX_FILE).c_str(), "r");
+  if(!file)
+  {
+    return;
+  }
+  uint64_t hash = 0u;
+  while(fscanf(file, "%" SCNx64, &hash) == 1)
+  {
+    gCachedPrograms.insert(hash);
+  }
+  fclose(file);
+}
+
+/**
+ * @brief Get the number of files and the bytes of the cache of the driver,
+ * i.e. of the cache directory without the index of the harness.
+ */
+void GetDriverCacheSize(uint64_t& files, uint64_t& bytes)
+{
+  files = 0u;
+  bytes = 0u;
+
+  std::error_code error;
+  for(fs::recursive_directory_iterator it(gShaderCacheDir, error), end; !error && it != end; it.increment(error))
+  {
+    if(it->is_regular_file(error) && it->path().filename() != SHADER_CACHE_INDEX_FILE)
+    {
+      ++files;
+      bytes += it->file_size(error);
+    }
+  }
+}
+
+void RecordProgram(const Property::Map& program)
+{
+  const Property::Value* vertex   = program.Find("vertex");
+  const Property::Value* fragment = program.Find("fragment");
+  std::string            vertexSource;
+  std::string            fragmentSource;
+  if(!vertex || !fragment || !vertex->Get(vertexSource) || !fragment->Get(fragmentSource))
+  {
+    return;
+  }
+
+  const uint64_t hash = HashProgram(vertexSource, fragmentSource);
+  if(!gSeenPrograms.insert(hash).second)
+  {
+    return; // Shared by another renderer, it is compiled once
+  }
+
+  if(gCachedPrograms.count(hash))
+  {
+    ++gShaderCacheCounts.programsSeenBefore;
+  }
+  else
+  {
+    ++gShaderCacheCounts.programsNew;
+    gNewPrograms.push_back(hash);
+  }
+}
+} // namespace
+
+void SetupShaderCache(const std::string& directory)
+{
+  const char* disabled = getenv("MESA_SHADER_CACHE_DISABLE");
+  if(disabled && strcmp(disabled, "false") && strcmp(disabled, "0"))
+  {
+    return; // Every program is a miss
+  }
+
+  // A cache chosen by the user for the driver is the cache of the harness too
+  const char* driverCacheDir = getenv("MESA_SHADER_CACHE_DIR");
+  gShaderCacheDir            = driverCacheDir ? driverCacheDir : (directory.empty() ? TestCachePath("shaders") : directory);
+
+  std::error_code error;
+  fs::create_directories(gShaderCacheDir, error);
+  if(error)
+  {
+    printf("The shader cache %s cannot be created: %s\n", gShaderCacheDir.c_str(), error.message().c_str());
+    gShaderCacheDir.clear();
+    return;
+  }
+
+  setenv("MESA_SHADER_CACHE_DIR", gShaderCacheDir.c_str(), 0);
+  LoadIndex();
+  GetDriverCacheSize(gDriverFiles, gDriverBytes);
+}
+
+void DisableShaderCache()
+{
+  setenv("MESA_SHADER_CACHE_DISABLE", "true", 1);
+  gShaderCacheDir.clear();
+  gCachedPrograms.clear();
+}
+
+void RecordShaderPrograms(Actor actor)
+{
+  for(uint32_t i = 0u; i < actor.GetRendererCount(); ++i)
+  {
+    // A program is a map of its sources, or an array of maps for the shaders of several render passes
+    const Property::Value program = actor.GetRendererAt(i).GetShader().GetProperty(Shader::Property::PROGRAM);
+    if(const Property::Map* map = program.GetMap())
+    {
+      RecordProgram(*map);
+    }
+    else if(const Property::Array* array = program.GetArray())
+    {
+      for(uint32_t j = 0u; j < array->Count(); ++j)
+      {
+        if(const Property::Map* passMap = array->GetElementAt(j).GetMap())
+        {
+          RecordProgram(*passMap);
+        }
+      }
+    }
+  }
+
+  for(uint32_t i = 0u; i < actor.GetChildCount(); ++i)
+  {
+    RecordShaderPrograms(actor.GetChildAt(i));
+  }
+}
+
+ShaderCacheCounts GetShaderCacheCounts()
+{
+  ShaderCacheCounts counts = gShaderCacheCounts;
+  if(!gShaderCacheDir.empty())
+  {
+    uint64_t files = 0u;
+    uint64_t bytes = 0u;
+    GetDriverCacheSize(files, bytes);
+
+    // The driver may also evict entries when the cache is full
+    counts.driverNewFiles = files > gDriverFiles ? files - gDriverFiles : 0u;
+    counts.driverNewBytes = bytes > gDriverBytes ? bytes - gDriverBytes : 0u;
+  }
+  return counts;
+}
+
+void SaveShaderCache()
+{
+  if(gShaderCacheDir.empty() || gNewPrograms.empty())
+  {
+    return;
+  }
+
+  // The programs added by the tests which have run since this one started are not added again
+  LoadIndex();
+
+  // Appended, so that the tests which run at the same time do not lose the programs of each other
+  FILE* file = fopen((gShaderCacheDir + "/" SHADER_CACHE_INDEX_FILE).c_str(), "a");
+  if(!file)
+  {
+    return;
+  }
+  for(uint64_t hash : gNewPrograms)
+  {
+    if(gCachedPrograms.insert(hash).second)
+    {
+      fprintf(file, "%016" PRIx64 "\n", hash);
+    }
+  }
+  fclose(file);
+  gNewPrograms.clear();
+}
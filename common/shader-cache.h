@@ -0,0 +1,89 @@
+#ifndef SHADER_CACHE_H
+#define SHADER_CACHE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/dali.h>
+#include <cstdint>
+#include <string>
+
+// The file of the shader cache which lists the programs compiled by the
+// previous runs, by the hash of their sources
+#define SHADER_CACHE_INDEX_FILE "programs.idx"
+
+/**
+ * @brief The programs of this run, and what the driver added to its cache.
+ *
+ * The programs seen before are those in the index of the harness, i.e. used
+ * by a previous run, which does not tell whether the driver still has them.
+ * Its cache only grows with the programs it compiles, so the entries and the
+ * bytes it has added during the run are its misses; they are 0 when every
+ * program has been found. The driver may write its cache in the background,
+ * so the programs compiled last can be missing from the growth.
+ */
+struct ShaderCacheCounts {
+  uint32_t programsSeenBefore = 0u; ///< In the index of the harness
+  uint32_t programsNew = 0u;        ///< Recorded for the first time
+  uint64_t driverNewFiles = 0u;     ///< The files the driver has added
+  uint64_t driverNewBytes = 0u;     ///< The bytes the driver has added
+};
+
+/**
+ * @brief Keep the compiled shader programs in a directory which outlives the
+ * test run, so that the next runs do not compile them again.
+ *
+ * The program binaries are kept by the GL driver, whose cache is keyed by the
+ * hash of the shader sources: the cache of Mesa (e.g. llvmpipe) is moved to
+ * the directory with MESA_SHADER_CACHE_DIR, unless it has been set already.
+ * The harness keeps the hashes of the programs it has seen in the same
+ * directory (see RecordShaderPrograms), and measures the growth of the cache
+ * of the driver (see ShaderCacheCounts).
+ *
+ * It must be called before Application::New, which loads the driver.
+ * @param[in] directory The directory, or empty for the cache directory of
+ * the user, e.g. ~/.cache/dali-visual-tests/shaders
+ */
+void SetupShaderCache(const std::string &directory);
+
+/**
+ * @brief Compile every program again, e.g. to measure the cold compilation.
+ * It must be called before Application::New.
+ */
+void DisableShaderCache();
+
+/**
+ * @brief Record the programs of the renderers of an actor and its children,
+ * each program once per process. It must be called on the event thread.
+ * @param[in] actor The actor
+ */
+void RecordShaderPrograms(Dali::Actor actor);
+
+/**
+ * @brief Get the programs recorded so far, and the growth of the cache of the
+ * driver since SetupShaderCache.
+ */
+ShaderCacheCounts GetShaderCacheCounts();
+
+/**
+ * @brief Add the programs recorded to the index of the cache, unless they are
+ * in it already, e.g. added by a test which has run at the same time.
+ */
+void SaveShaderCache();
+
+#endif // SHADER_CACHE_H
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "startup-timeline.h"
+
+// EXTERNAL INCLUDES
+#include <time.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+const char* PHASE_NAMES[STARTUP_PHASE_COUNT] = {
+  "process-start",
+  "main",
+  "application-new",
+  "init-signal",
+  "first-update",
+  "first-frame",
+  "control-ready",
+};
+
+// The CLOCK_MONOTONIC time of each phase in nanoseconds, 0 until it is reached
+std::atomic<long long> gPhaseTimes[STARTUP_PHASE_COUNT];
+
+long long GetClockNs(clockid_t clock)
+{
+  timespec time;
+  clock_gettime(clock, &time);
+  return static_cast<long long>(time.tv_sec) * 1000000000ll + time.tv_nsec;
+}
+
+/**
+ * @brief Get the CLOCK_MONOTONIC time at which the process started.
+ *
+ * The kernel keeps it in clock ticks since boot (field 22 of /proc/self/stat),
+ * i.e. to 10 ms at best, so the time given by the parent is preferred.
+ */
+long long GetProcessStartNs()
+{
+  const char*     execTime   = getenv(STARTUP_EXEC_TIME_ENV);
+  const long long execTimeNs = execTime ? atoll(execTime) : 0;
+  if(execTimeNs > 0)
+  {
+    // From the wall clock of the parent to the monotonic clock
+    return GetClockNs(CLOCK_MONOTONIC) - (GetClockNs(CLOCK_REALTIME) - execTimeNs);
+  }
+
+  FILE* file = fopen("/proc/self/stat", "r");
+  if(!file)
+  {
+    return 0;
+  }
+  char       line[1024] = {};
+  const bool read       = fgets(line, sizeof(line), file) != nullptr;
+  fclose(file);
+
+  // The name of the executable may contain spaces, the fields are counted from its closing parenthesis
+  const char*        fields     = read ? strrchr(line, ')') : nullptr;
+  unsigned long long startTicks = 0u;
+  if(!fields || sscanf(fields + 2, "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %*u %*u %*d %*d %*d %*d %*d %*d %llu", &startTicks) != 1)
+  {
+    return 0;
+  }
+
+  // From the time since boot to the monotonic clock, which does not count the suspended time
+  const long long startBootNs = static_cast<long long>(startTicks) * (1000000000ll / sysconf(_SC_CLK_TCK));
+  return GetClockNs(CLOCK_MONOTONIC) - (GetClockNs(CLOCK_BOOTTIME) - startBootNs);
+}
+} // namespace
+
+void MarkStartupPhase(StartupPhase phase)
+{
+  long long expected = 0;
+  gPhaseTimes[phase].compare_exchange_strong(expected, GetClockNs(CLOCK_MONOTONIC));
+}
+
+double GetStartupPhaseMs(StartupPhase phase)
+{
+  if(phase == STARTUP_PROCESS_START)
+  {
+    return 0.0;
+  }
+
+  static const long long processStartNs = GetProcessStartNs();
+  const long long        phaseNs        = gPhaseTimes[phase].load();
+  if(phaseNs == 0 || processStartNs == 0)
+  {
+    return -1.0;
+  }
+  return static_cast<double>(phaseNs - processStartNs) / 1000000.0;
+}
+
+const char* GetStartupPhaseName(StartupPhase phase)
+{
+  return PHASE_NAMES[phase];
+}
+
+long long GetStartupClockNs()
+{
+  return GetClockNs(CLOCK_REALTIME);
+}
@@ -0,0 +1,68 @@
+#ifndef STARTUP_TIMELINE_H
+#define STARTUP_TIMELINE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// The environment variable with the CLOCK_REALTIME time in nanoseconds at
+// which the parent executed the process, more precise than /proc/self/stat.
+// It is the wall clock so that execute.sh can give it as well.
+#define STARTUP_EXEC_TIME_ENV "DALI_STARTUP_EXEC_TIME"
+
+/**
+ * @brief The phases of the startup of a test application, in order.
+ */
+enum StartupPhase {
+  STARTUP_PROCESS_START,   ///< The process has been executed
+  STARTUP_MAIN,            ///< main has been entered, i.e. the libraries are loaded
+  STARTUP_APPLICATION_NEW, ///< Application::New has returned
+  STARTUP_INIT_SIGNAL,     ///< The InitSignal has been emitted
+  STARTUP_FIRST_UPDATE,    ///< The update thread has updated the first frame
+  STARTUP_FIRST_FRAME,     ///< The first frame has been presented
+  STARTUP_CONTROL_READY,   ///< The first controls are ready, marked by the test
+  STARTUP_PHASE_COUNT
+};
+
+/**
+ * @brief Mark that the process has reached a phase of its startup.
+ *
+ * Only the first mark of a phase counts, so the harness can mark the phases
+ * which happen for every frame. It can be called from any thread.
+ * @param[in] phase The phase reached
+ */
+void MarkStartupPhase(StartupPhase phase);
+
+/**
+ * @brief Get the time at which a phase has been reached.
+ * @param[in] phase The phase
+ * @return The time from the start of the process in milliseconds, or -1 if
+ * the phase has not been reached
+ */
+double GetStartupPhaseMs(StartupPhase phase);
+
+/**
+ * @brief Get the name of a phase, e.g. "first-frame".
+ */
+const char *GetStartupPhaseName(StartupPhase phase);
+
+/**
+ * @brief Get the current CLOCK_REALTIME time in nanoseconds, as given to a
+ * child process in STARTUP_EXEC_TIME_ENV.
+ */
+long long GetStartupClockNs();
+
+#endif // STARTUP_TIMELINE_H
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "step-sequencer.h"
+#include "visual-test.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdio>
+
+using namespace Dali;
+
+StepSequencer::Step& StepSequencer::Step::Do(std::function<void()> action)
+{
+  mAction = action;
+  return *this;
+}
+
+StepSequencer::Step& StepSequencer::Step::WaitForResourceReady(Toolkit::Control control)
+{
+  mControls.push_back(control);
+  return *this;
+}
+
+StepSequencer::Step& StepSequencer::Step::WaitForAnimation(Animation animation)
+{
+  mAnimations.push_back(animation);
+  return *this;
+}
+
+StepSequencer::Step& StepSequencer::Step::WaitForAnimation(std::function<Animation()> animation)
+{
+  mAnimationGetters.push_back(animation);
+  return *this;
+}
+
+StepSequencer::Step& StepSequencer::Step::WaitForFrames(uint32_t frames)
+{
+  mFrames = frames;
+  return *this;
+}
+
+StepSequencer::Step& StepSequencer::Step::WaitForTime(uint32_t milliseconds)
+{
+  mTime    = milliseconds;
+  mHasTime = true;
+  return *this;
+}
+
+StepSequencer::Step& StepSequencer::Step::WaitUntil(std::function<bool()> condition)
+{
+  mConditions.push_back(condition);
+  return *this;
+}
+
+StepSequencer::Step& StepSequencer::Step::Then(std::function<void()> action)
+{
+  mThen = action;
+  return *this;
+}
+
+StepSequencer::Step& StepSequencer::Step::Capture(CameraActor camera)
+{
+  mCapture = true;
+  mCamera  = camera;
+  return *this;
+}
+
+StepSequencer::Step& StepSequencer::Step::Capture(std::function<Window()> window)
+{
+  mCapture      = true;
+  mWindowGetter = window;
+  return *this;
+}
+
+StepSequencer::Step& StepSequencer::Step::MaxWait(uint32_t milliseconds)
+{
+  mMaxWait = milliseconds;
+  return *this;
+}
+
+StepSequencer::StepSequencer(VisualTest& test)
+: mTest(test),
+  mWindow(),
+  mCurrentStep(-1),
+  mWaiting(false),
+  mFramesUpdated(0u),
+  mTimeElapsed(false)
+{
+}
+
+StepSequencer::Step& StepSequencer::AddStep(const std::string& name)
+{
+  mSteps.push_back(std::make_unique<Step>());
+  mSteps.back()->mName = name;
+  return *mSteps.back();
+}
+
+void StepSequencer::SetFinishedCallback(std::function<void()> callback)
+{
+  mFinishedCallback = callback;
+}
+
+void StepSequencer::Start(Window window)
+{
+  mWindow      = window;
+  mCurrentStep = -1;
+  Next();
+}
+
+void StepSequencer::Next()
+{
+  ++mCurrentStep;
+  if(mCurrentStep < GetStepCount())
+  {
+    StartStep();
+  }
+  else if(mFinishedCallback)
+  {
+    mFinishedCallback();
+  }
+}
+
+int StepSequencer::GetCurrentStep() const
+{
+  return mCurrentStep;
+}
+
+int StepSequencer::GetStepCount() const
+{
+  return static_cast<int>(mSteps.size());
+}
+
+VirtualClock& StepSequencer::GetClock()
+{
+  return mClock;
+}
+
+void StepSequencer::StartStep()
+{
+  Step& step = *mSteps[mCurrentStep];
+
+  // The step gives up waiting before the watchdog expires, so that it fails cleanly
+  mTest.BeginStep(step.mName, std::max(gStepTimeout, step.mMaxWait + STEP_WATCHDOG_MARGIN));
+
+  mWaiting       = true;
+  mFramesUpdated = 0u;
+  mTimeElapsed   = !step.mHasTime;
+  mFinishedAnimations.clear();
+
+  if(step.mAction)
+  {
+    step.mAction();
+  }
+
+  // The conditions are connected after the action, which may have started the animations or loading
+  for(auto& control : step.mControls)
+  {
+    control.ResourceReadySignal().Connect(this, &StepSequencer::OnResourceReady);
+  }
+  mAnimations = step.mAnimations;
+  for(auto& getAnimation : step.mAnimationGetters)
+  {
+    if(Animation animation = getAnimation())
+    {
+      mAnimations.push_back(animation);
+    }
+  }
+  for(auto& animation : mAnimations)
+  {
+    animation.FinishedSignal().Connect(this, &StepSequencer::OnAnimationFinished);
+  }
+  if(step.mFrames > 0u)
+  {
+    RequestFrame();
+  }
+  if(step.mHasTime)
+  {
+    const int stepIndex = mCurrentStep;
+    mClock.Wait(step.mTime, [this, stepIndex]() {
+      if(stepIndex == mCurrentStep)
+      {
+        mTimeElapsed = true;
+        Check();
+      }
+    });
+  }
+
+  if(!step.mConditions.empty())
+  {
+    mPollTimer = Timer::New(STEP_POLL_INTERVAL);
+    mPollTimer.TickSignal().Connect(this, &StepSequencer::OnPoll);
+    mPollTimer.Start();
+  }
+
+  mMaxWaitTimer = Timer::New(step.mMaxWait);
+  mMaxWaitTimer.TickSignal().Connect(this, &StepSequencer::OnMaxWait);
+  mMaxWaitTimer.Start();
+
+  Check();
+}
+
+void StepSequencer::Check()
+{
+  if(!mWaiting)
+  {
+    return;
+  }
+
+  const Step& step = *mSteps[mCurrentStep];
+
+  const bool resourcesReady = std::all_of(step.mControls.begin(), step.mControls.end(), [](const Toolkit::Control& control) { return control.IsResourceReady(); });
+  const bool animationsDone = std::all_of(mAnimations.begin(), mAnimations.end(), [this](const Animation& animation) { return std::find(mFinishedAnimations.begin(), mFinishedAnimations.end(), animation) != mFinishedAnimations.end(); });
+  const bool conditionsHold = std::all_of(step.mConditions.begin(), step.mConditions.end(), [](const std::function<bool()>& condition) { return condition(); });
+
+  if(resourcesReady && animationsDone && mFramesUpdated >= step.mFrames && mTimeElapsed && conditionsHold)
+  {
+    Complete(false);
+  }
+}
+
+void StepSequencer::Complete(bool gaveUp)
+{
+  Step& step = *mSteps[mCurrentStep];
+
+  mWaiting = false;
+  mMaxWaitTimer.Stop();
+  mMaxWaitTimer.Reset();
+  if(mFrameAnimation)
+  {
+    // Otherwise the frame still awaited by a step which gave up would count in the next step
+    mFrameAnimation.FinishedSignal().Disconnect(this, &StepSequencer::OnFrameUpdated);
+    mFrameAnimation.Stop();
+    mFrameAnimation.Reset();
+  }
+  if(mPollTimer)
+  {
+    mPollTimer.Stop();
+    mPollTimer.Reset();
+  }
+
+  for(auto& control : step.mControls)
+  {
+    control.ResourceReadySignal().Disconnect(this, &StepSequencer::OnResourceReady);
+  }
+  for(auto& animation : mAnimations)
+  {
+    animation.FinishedSignal().Disconnect(this, &StepSequencer::OnAnimationFinished);
+  }
+  mAnimations.clear();
+
+  if(gaveUp)
+  {
+    printf("STEP: %s gave up waiting after %u ms\n", step.mName.c_str(), step.mMaxWait);
+    fflush(stdout);
+    mTest.FailStep("gave up waiting after " + std::to_string(step.mMaxWait) + " ms");
+  }
+
+  if(step.mThen)
+  {
+    step.mThen();
+  }
+
+  if(step.mCapture)
+  {
+    mTest.CaptureWindowAfterFrameRendered(step.mWindowGetter ? step.mWindowGetter() : mWindow, step.mCamera);
+  }
+  else
+  {
+    Next();
+  }
+}
+
+void StepSequencer::RequestFrame()
+{
+  // A zero duration animation finishes once the next frame has been updated
+  mFrameAnimation = Animation::New(0);
+  mFrameAnimation.FinishedSignal().Connect(this, &StepSequencer::OnFrameUpdated);
+  mFrameAnimation.Play();
+}
+
+void StepSequencer::OnResourceReady(Toolkit::Control /* not used */)
+{
+  Check();
+}
+
+void StepSequencer::OnAnimationFinished(Animation& animation)
+{
+  mFinishedAnimations.push_back(animation);
+  Check();
+}
+
+void StepSequencer::OnFrameUpdated(Animation /* not used */)
+{
+  if(!mWaiting)
+  {
+    return;
+  }
+
+  ++mFramesUpdated;
+  if(mFramesUpdated < mSteps[mCurrentStep]->mFrames)
+  {
+    RequestFrame();
+  }
+  Check();
+}
+
+bool StepSequencer::OnMaxWait()
+{
+  if(mWaiting)
+  {
+    Complete(true);
+  }
+  return false;
+}
+
+bool StepSequencer::OnPoll()
+{
+  Check();
+  return mWaiting;
+}
@@ -0,0 +1,246 @@
+#ifndef STEP_SEQUENCER_H
+#define STEP_SEQUENCER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/dali.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "virtual-clock.h"
+
+class VisualTest;
+
+// The default maximum time a step waits for its conditions in milliseconds
+#define DEFAULT_STEP_MAX_WAIT 5000u
+
+// The interval at which the conditions of WaitUntil are checked in milliseconds
+#define STEP_POLL_INTERVAL 10u
+
+// The time left to the capture and the comparison of a step after its maximum
+// wait, before the watchdog expires, in milliseconds
+#define STEP_WATCHDOG_MARGIN 10000u
+
+/**
+ * @brief Runs the steps of a visual test one after the other.
+ *
+ * Each step declares what it does and the conditions it waits for before the
+ * window is captured. The step moves on as soon as all its conditions hold,
+ * rather than after a fixed delay, and gives up waiting after its maximum wait
+ * (the capture is then taken anyway, and the comparison shows what is wrong).
+ * A step which gives up is a failure of the test (see TestResults::AddFailure).
+ *
+ * @code
+ * mSequencer.AddStep("image-change")
+ *     .Do([this]() { ChangeImage(); })
+ *     .WaitForResourceReady(mImageView)
+ *     .Capture();
+ * mSequencer.SetFinishedCallback([this]() { mApplication.Quit(); });
+ * mSequencer.Start(mApplication.GetWindow());
+ *
+ * void PostRender(std::string outputFile, bool success) {
+ *   if (!CompareImageFile(EXPECTED[mSequencer.GetCurrentStep()], outputFile,
+ *                         0.98f) && RetryCapture()) {
+ *     return;
+ *   }
+ *   mSequencer.Next();
+ * }
+ * @endcode
+ *
+ * Every step is also a step of the watchdog (see VisualTest::BeginStep).
+ */
+class StepSequencer : public Dali::ConnectionTracker {
+public:
+  /**
+   * @brief The declaration of a step.
+   */
+  class Step {
+  public:
+    /**
+     * @brief Set what the step does when it starts.
+     */
+    Step &Do(std::function<void()> action);
+
+    /**
+     * @brief Wait until the control has loaded all its resources, i.e. its
+     * textures are ready to be rendered.
+     */
+    Step &WaitForResourceReady(Dali::Toolkit::Control control);
+
+    /**
+     * @brief Wait until the animation has finished.
+     */
+    Step &WaitForAnimation(Dali::Animation animation);
+
+    /**
+     * @brief Wait until the animation given by the function has finished.
+     * The function is called when the step starts, after its action, e.g. for
+     * an animation created by a previous step. An empty handle is not waited
+     * for.
+     */
+    Step &WaitForAnimation(std::function<Dali::Animation()> animation);
+
+    /**
+     * @brief Wait until the given number of frames have been updated.
+     */
+    Step &WaitForFrames(uint32_t frames);
+
+    /**
+     * @brief Wait until the given time has passed on the clock of the
+     * sequencer, i.e. a virtual time with --virtual-clock (see GetClock()).
+     * Use it only where the time itself is what the step waits for, e.g. to
+     * stop an animation half way.
+     */
+    Step &WaitForTime(uint32_t milliseconds);
+
+    /**
+     * @brief Wait until the condition holds, for what has no signal, e.g. the
+     * exit of a child process. It is checked every STEP_POLL_INTERVAL ms on
+     * the event thread, so it must not block.
+     */
+    Step &WaitUntil(std::function<bool()> condition);
+
+    /**
+     * @brief Set what the step does once its conditions hold, before the
+     * capture.
+     */
+    Step &Then(std::function<void()> action);
+
+    /**
+     * @brief Capture the window once the conditions hold. PostRender is then
+     * called, and it must call StepSequencer::Next() to move on. A step which
+     * does not capture moves on by itself.
+     * @param[in] camera The custom camera of the capture, if any
+     */
+    Step &Capture(Dali::CameraActor camera = Dali::CameraActor());
+
+    /**
+     * @brief Capture another window than the one the sequencer was started
+     * with once the conditions hold, e.g. a window created by the step. The
+     * function is called at the capture, after the action of the step.
+     * @param[in] window The function which gives the window to capture
+     */
+    Step &Capture(std::function<Dali::Window()> window);
+
+    /**
+     * @brief Set the maximum time to wait for the conditions in milliseconds.
+     * The deadline of the watchdog for the step is at least this time and
+     * STEP_WATCHDOG_MARGIN, and includes the action of the step.
+     */
+    Step &MaxWait(uint32_t milliseconds);
+
+  private:
+    friend class StepSequencer;
+
+    std::string mName;
+    std::function<void()> mAction;
+    std::function<void()> mThen;
+    std::vector<Dali::Toolkit::Control> mControls;
+    std::vector<Dali::Animation> mAnimations;
+    std::vector<std::function<Dali::Animation()>> mAnimationGetters;
+    std::vector<std::function<bool()>> mConditions;
+    uint32_t mFrames = 0u;
+    uint32_t mTime = 0u;
+    bool mHasTime = false;
+    bool mCapture = false;
+    Dali::CameraActor mCamera;
+    std::function<Dali::Window()> mWindowGetter;
+    uint32_t mMaxWait = DEFAULT_STEP_MAX_WAIT;
+  };
+
+  /**
+   * @brief Constructor.
+   * @param[in] test The test which captures the window
+   */
+  explicit StepSequencer(VisualTest &test);
+
+  /**
+   * @brief Add a step at the end of the sequence.
+   * @param[in] name The name of the step, as reported by the watchdog
+   * @return The step to declare
+   */
+  Step &AddStep(const std::string &name);
+
+  /**
+   * @brief Set the function called once the last step has finished.
+   */
+  void SetFinishedCallback(std::function<void()> callback);
+
+  /**
+   * @brief Start the first step.
+   * @param[in] window The window the steps capture
+   */
+  void Start(Dali::Window window);
+
+  /**
+   * @brief Move on to the next step, to be called from PostRender.
+   */
+  void Next();
+
+  /**
+   * @brief Get the index of the current step, starting from 0.
+   */
+  int GetCurrentStep() const;
+
+  /**
+   * @brief Get the number of steps.
+   */
+  int GetStepCount() const;
+
+  /**
+   * @brief Get the clock of WaitForTime. The animations the steps wait for in
+   * time must be played with this clock.
+   */
+  VirtualClock &GetClock();
+
+private:
+  void StartStep();
+  void Check();
+  void Complete(bool gaveUp);
+  void RequestFrame();
+
+  void OnResourceReady(Dali::Toolkit::Control control);
+  void OnAnimationFinished(Dali::Animation &animation);
+  void OnFrameUpdated(Dali::Animation animation);
+  bool OnMaxWait();
+  bool OnPoll();
+
+private:
+  VisualTest &mTest;
+  Dali::Window mWindow;
+  std::vector<std::unique_ptr<Step>> mSteps;
+  std::function<void()> mFinishedCallback;
+  VirtualClock mClock;
+
+  int mCurrentStep;
+  bool mWaiting; ///< Whether the current step waits for its conditions
+  uint32_t mFramesUpdated;
+  bool mTimeElapsed;
+  std::vector<Dali::Animation> mAnimations; ///< Awaited by the current step
+  std::vector<Dali::Animation> mFinishedAnimations;
+  Dali::Animation mFrameAnimation;
+  Dali::Timer mMaxWaitTimer;
+  Dali::Timer mPollTimer; ///< Checks the conditions of WaitUntil
+};
+
+#endif // STEP_SEQUENCER_H
@@ -0,0 +1,100 @@
+#ifndef TEST_METADATA_H
+#define TEST_METADATA_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+// The ELF section which holds the metadata record of a visual test
+#define TEST_METADATA_SECTION ".dali_test_meta"
+
+// The magic bytes at the start of the metadata record
+#define TEST_METADATA_MAGIC "DALITST"
+
+// The version of the layout of the metadata record, 2 since the flags
+#define TEST_METADATA_VERSION 2u
+
+// The flag of the benchmarks, which execute.sh only runs with --benchmarks
+#define TEST_METADATA_FLAG_BENCHMARK 0x1u
+
+// The size of the string fields of the metadata record, including the NUL
+#define TEST_METADATA_NAME_LENGTH 64
+#define TEST_METADATA_PATH_LENGTH 256
+
+/**
+ * @brief The metadata of a visual test, stored in its own section of the
+ * test executable so that the runner can read it without executing the test.
+ *
+ * The layout is fixed and does not contain any pointer, so the record can be
+ * read directly from the file, e.g.
+ * @code
+ * objcopy -O binary --only-section=.dali_test_meta my-test.test meta.bin
+ * # version, width, height, steps, timeout and flags
+ * od -An -w24 -t u4 -j 8 -N 24 meta.bin
+ * @endcode
+ *
+ * Integers are stored in the byte order of the target. Strings are NUL
+ * terminated and padded with NUL up to the size of their field.
+ */
+struct VisualTestMetadata {
+  char magic[8];          ///< TEST_METADATA_MAGIC
+  uint32_t version;       ///< TEST_METADATA_VERSION
+  uint32_t windowWidth;   ///< The width of the main window
+  uint32_t windowHeight;  ///< The height of the main window
+  uint32_t stepCount;     ///< The number of steps, or 0 if not known
+  uint32_t stepTimeout;   ///< The deadline of a step in milliseconds
+  uint32_t flags;         ///< TEST_METADATA_FLAG_*
+  char name[TEST_METADATA_NAME_LENGTH];          ///< The class of the test
+  char imageDir[TEST_METADATA_PATH_LENGTH];      ///< TEST_IMAGE_DIR
+  char sceneDir[TEST_METADATA_PATH_LENGTH];      ///< TEST_SCENE_DIR
+  char resourcesDir[TEST_METADATA_PATH_LENGTH];  ///< TEST_RESOURCES_DIR
+};
+
+static_assert(sizeof(VisualTestMetadata) ==
+                  32 + TEST_METADATA_NAME_LENGTH + 3 * TEST_METADATA_PATH_LENGTH,
+              "The metadata record must not contain any padding");
+
+/**
+ * DALI_VISUAL_TEST_METADATA defines the metadata record of the visual test.
+ * It is used by the DALI_VISUAL_TEST* macros and must appear once per test.
+ * @param[in] VisualTestName The class name of the visual test
+ * @param[in] WindowWidth The width of the application's main window
+ * @param[in] WindowHeight The height of the application's main window
+ * @param[in] StepCount The number of steps of the test, or 0 if not known
+ * @param[in] StepTimeout The deadline of a step in milliseconds
+ * @param[in] Flags The TEST_METADATA_FLAG_* of the test
+ */
+#define DALI_VISUAL_TEST_METADATA(VisualTestName, WindowWidth, WindowHeight,   \
+                                  StepCount, StepTimeout, Flags)               \
+  extern const VisualTestMetadata gTestMetadata;                               \
+  __attribute__((section(TEST_METADATA_SECTION), used))                        \
+  const VisualTestMetadata gTestMetadata = {                                   \
+      TEST_METADATA_MAGIC,                                                     \
+      TEST_METADATA_VERSION,                                                   \
+      static_cast<uint32_t>(WindowWidth),                                      \
+      static_cast<uint32_t>(WindowHeight),                                     \
+      static_cast<uint32_t>(StepCount),                                        \
+      static_cast<uint32_t>(StepTimeout),                                      \
+      static_cast<uint32_t>(Flags),                                            \
+      #VisualTestName,                                                         \
+      TEST_IMAGE_DIR,                                                          \
+      TEST_SCENE_DIR,                                                          \
+      TEST_RESOURCES_DIR};
+
+#endif // TEST_METADATA_H
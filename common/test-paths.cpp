@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "test-paths.h"
+
+// EXTERNAL INCLUDES
+#include <cstdlib>
+
+namespace
+{
+/**
+ * @brief Get the directory from the environment variable, or the compile time default.
+ */
+std::string GetDirectory(const char* variable, const char* defaultDirectory)
+{
+  const char* value = getenv(variable);
+  if(!value || !*value)
+  {
+    return defaultDirectory;
+  }
+
+  std::string directory(value);
+  if(directory.back() != '/')
+  {
+    directory += '/';
+  }
+  return directory;
+}
+} // namespace
+
+std::string TestImagePath(const std::string& relativePath)
+{
+  return GetDirectory("TEST_IMAGE_DIR", TEST_IMAGE_DIR) + relativePath;
+}
+
+std::string TestScenePath(const std::string& relativePath)
+{
+  return GetDirectory("TEST_SCENE_DIR", TEST_SCENE_DIR) + relativePath;
+}
+
+std::string TestResourcesPath(const std::string& relativePath)
+{
+  return GetDirectory("TEST_RESOURCES_DIR", TEST_RESOURCES_DIR) + relativePath;
+}
+
+std::string TestCachePath(const std::string& relativePath)
+{
+  if(const char* cacheHome = getenv("XDG_CACHE_HOME"))
+  {
+    return std::string(cacheHome) + "/dali-visual-tests/" + relativePath;
+  }
+  if(const char* home = getenv("HOME"))
+  {
+    return std::string(home) + "/.cache/dali-visual-tests/" + relativePath;
+  }
+  return "/tmp/dali-tests/cache/" + relativePath;
+}
@@ -0,0 +1,65 @@
+#ifndef TEST_PATHS_H
+#define TEST_PATHS_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+
+/**
+ * The directories of the test data are given at compile time with the
+ * TEST_IMAGE_DIR, TEST_SCENE_DIR and TEST_RESOURCES_DIR macros, i.e. where the
+ * data is installed. Each of them can be overridden at run time with the
+ * environment variable of the same name, e.g. when the runner has staged a
+ * copy of the data in a tmpfs.
+ *
+ * The functions only read the environment, so they can be used to initialise
+ * static variables.
+ */
+
+/**
+ * @brief Get the path of a file in the image directory.
+ * @param[in] relativePath The path relative to the image directory
+ * @return The path of the file
+ */
+std::string TestImagePath(const std::string &relativePath = std::string());
+
+/**
+ * @brief Get the path of a file in the scene directory.
+ * @param[in] relativePath The path relative to the scene directory
+ * @return The path of the file
+ */
+std::string TestScenePath(const std::string &relativePath = std::string());
+
+/**
+ * @brief Get the path of a file in the resources directory.
+ * @param[in] relativePath The path relative to the resources directory
+ * @return The path of the file
+ */
+std::string TestResourcesPath(const std::string &relativePath = std::string());
+
+/**
+ * @brief Get the path of a file in the cache directory of the harness, which
+ * keeps the files derived from the test data across the runs, e.g.
+ * $XDG_CACHE_HOME/dali-visual-tests/ or ~/.cache/dali-visual-tests/.
+ * @param[in] relativePath The path relative to the cache directory
+ * @return The path of the file
+ */
+std::string TestCachePath(const std::string &relativePath = std::string());
+
+#endif // TEST_PATHS_H
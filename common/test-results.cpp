@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "test-results.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+namespace
+{
+void WriteMemorySample(FILE* output, const MemorySample& sample)
+{
+  fprintf(output,
+          "{\"rssKb\": %" PRIu64 ", \"pssKb\": %" PRIu64 ", \"heapKb\": %" PRIu64 ", \"gpuKb\": %" PRIu64 ", \"gpuBuffers\": %u}",
+          sample.rssKb,
+          sample.pssKb,
+          sample.heapKb,
+          sample.gpuKb,
+          sample.gpuBuffers);
+}
+
+void WritePerfCounters(FILE* output, const PerfCounterValues& counters)
+{
+  const char* separator = "{";
+  for(int i = 0; i < PERF_COUNTER_COUNT; ++i)
+  {
+    fprintf(output, "%s\"%s\": ", separator, PerfCounterValues::GetName(i));
+    if(counters.values[i] >= 0)
+    {
+      fprintf(output, "%" PRId64, counters.values[i]);
+    }
+    else
+    {
+      fprintf(output, "null");
+    }
+    separator = ", ";
+  }
+  fprintf(output, "}");
+}
+
+void WriteFrameTimes(FILE* output, const FrameTimeSummary& summary)
+{
+  fprintf(output,
+          "{\"count\": %" PRIu64 ", \"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f}",
+          summary.count,
+          summary.p50Ms,
+          summary.p90Ms,
+          summary.p99Ms,
+          summary.maxMs);
+}
+
+int ExitValueOf(const StepResult& result)
+{
+  // The exit value of a failed test must never read as a pass
+  return std::max(1, static_cast<int>(33.3f * (result.similarity[0] + result.similarity[1] + result.similarity[2])));
+}
+} // namespace
+
+void WriteJsonString(FILE* output, const std::string& value)
+{
+  fputc('"', output);
+  for(unsigned char c : value)
+  {
+    if(c == '"' || c == '\\')
+    {
+      fprintf(output, "\\%c", c);
+    }
+    else if(c < 0x20)
+    {
+      fprintf(output, "\\u%04x", c);
+    }
+    else
+    {
+      fputc(c, output);
+    }
+  }
+  fputc('"', output);
+}
+
+void TestResults::Add(const StepResult& result)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mResults.push_back(result);
+}
+
+void TestResults::MarkLastRetried()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  if(!mResults.empty())
+  {
+    mResults.back().retried = true;
+  }
+}
+
+void TestResults::AddFailure(const StepFailure& failure)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mFailures.push_back(failure);
+}
+
+void TestResults::AddTiming(const StepTiming& timing)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mTimings.push_back(timing);
+}
+
+void TestResults::AddMemory(const StepMemory& memory)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mMemory.push_back(memory);
+}
+
+void TestResults::AddCounters(const StepCounters& counters)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mCounters.push_back(counters);
+}
+
+void TestResults::AddFrames(const WindowFrames& frames)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mFrames.push_back(frames);
+}
+
+void TestResults::AddMetric(const std::string& name, double value, const std::string& unit)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mMetrics.push_back({name, value, unit});
+}
+
+size_t TestResults::GetCount() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mResults.size();
+}
+
+std::vector<StepResult> TestResults::GetResults() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mResults;
+}
+
+std::vector<StepTiming> TestResults::GetTimings() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mTimings;
+}
+
+std::vector<StepMemory> TestResults::GetMemory() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mMemory;
+}
+
+std::vector<TestMetric> TestResults::GetMetrics() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mMetrics;
+}
+
+bool TestResults::HasFailure() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return !mFailures.empty() || std::any_of(mResults.begin(), mResults.end(), [](const StepResult& result) { return !result.passed && !result.retried; });
+}
+
+int TestResults::GetExitValue(int defaultValue) const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  if(mResults.empty() && mFailures.empty())
+  {
+    return defaultValue;
+  }
+
+  // A step which has failed has no similarity, so it is reported as the worst
+  int exitValue = mFailures.empty() ? 0 : 1;
+  for(const auto& result : mResults)
+  {
+    if(!result.passed && !result.retried)
+    {
+      const int value = ExitValueOf(result);
+      exitValue       = (exitValue == 0) ? value : std::min(exitValue, value);
+    }
+  }
+  return exitValue;
+}
+
+bool TestResults::Write(const std::string& fileName, const std::string& testName, bool complete, int exitValue) const
+{
+  FILE* output = fopen(fileName.c_str(), "w");
+  if(!output)
+  {
+    fprintf(stderr, "Unable to open the results file %s\n", fileName.c_str());
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mMutex);
+
+  fprintf(output, "{\n  \"test\": ");
+  WriteJsonString(output, testName);
+  fprintf(output, ",\n  \"complete\": %s,\n  \"exitValue\": %d,\n  \"steps\": [", complete ? "true" : "false", exitValue);
+
+  const char* separator = "\n";
+  for(const auto& result : mResults)
+  {
+    fprintf(output, "%s    {\"index\": %d, \"name\": ", separator, result.stepIndex);
+    WriteJsonString(output, result.stepName);
+    fprintf(output, ", \"golden\": ");
+    WriteJsonString(output, result.golden);
+    fprintf(output, ", \"output\": ");
+    WriteJsonString(output, result.output);
+    fprintf(output,
+            ", \"similarity\": {\"r\": %f, \"g\": %f, \"b\": %f}, \"threshold\": %f, \"passed\": %s, \"durationMs\": %.3f, \"frameMs\": %.3f, \"attempt\": %d, \"retried\": %s}",
+            result.similarity[0],
+            result.similarity[1],
+            result.similarity[2],
+            result.threshold,
+            result.passed ? "true" : "false",
+            result.durationMs,
+            result.frameMs,
+            result.attempt,
+            result.retried ? "true" : "false");
+    separator = ",\n";
+  }
+  fprintf(output, "\n  ],\n  \"failures\": [");
+
+  separator = "\n";
+  for(const auto& failure : mFailures)
+  {
+    fprintf(output, "%s    {\"index\": %d, \"name\": ", separator, failure.stepIndex);
+    WriteJsonString(output, failure.stepName);
+    fprintf(output, ", \"reason\": ");
+    WriteJsonString(output, failure.reason);
+    fprintf(output, "}");
+    separator = ",\n";
+  }
+  fprintf(output, "\n  ],\n  \"timings\": [");
+
+  separator = "\n";
+  for(const auto& timing : mTimings)
+  {
+    fprintf(output, "%s    {\"index\": %d, \"name\": ", separator, timing.stepIndex);
+    WriteJsonString(output, timing.stepName);
+    fprintf(output, ", \"durationMs\": %.3f}", timing.durationMs);
+    separator = ",\n";
+  }
+  fprintf(output, "\n  ],\n  \"memory\": [");
+
+  separator = "\n";
+  for(const auto& memory : mMemory)
+  {
+    fprintf(output, "%s    {\"index\": %d, \"name\": ", separator, memory.stepIndex);
+    WriteJsonString(output, memory.stepName);
+    fprintf(output, ", \"start\": ");
+    WriteMemorySample(output, memory.start);
+    fprintf(output, ", \"end\": ");
+    WriteMemorySample(output, memory.end);
+    fprintf(output,
+            ", \"peakRssKb\": %" PRIu64 ", \"retainedKb\": %" PRId64 ", \"overBudget\": %s}",
+            memory.peakRssKb,
+            memory.retainedKb,
+            memory.overBudget ? "true" : "false");
+    separator = ",\n";
+  }
+  fprintf(output, "\n  ],\n  \"counters\": [");
+
+  separator = "\n";
+  for(const auto& counters : mCounters)
+  {
+    fprintf(output, "%s    {\"index\": %d, \"name\": ", separator, counters.stepIndex);
+    WriteJsonString(output, counters.stepName);
+    fprintf(output, ", \"step\": ");
+    WritePerfCounters(output, counters.step);
+    fprintf(output, ", \"compare\": ");
+    WritePerfCounters(output, counters.compare);
+    fprintf(output, "}");
+    separator = ",\n";
+  }
+  fprintf(output, "\n  ],\n  \"frames\": [");
+
+  separator = "\n";
+  for(const auto& frames : mFrames)
+  {
+    fprintf(output, "%s    {\"window\": %d, \"latencyMs\": ", separator, frames.windowIndex);
+    WriteFrameTimes(output, frames.latency);
+    fprintf(output, ", \"intervalMs\": ");
+    WriteFrameTimes(output, frames.interval);
+    fprintf(output, ", \"dropped\": %" PRIu64 ", \"idleGaps\": %" PRIu64 "}", frames.dropped, frames.idleGaps);
+    separator = ",\n";
+  }
+  fprintf(output, "\n  ],\n  \"metrics\": [");
+
+  separator = "\n";
+  for(const auto& metric : mMetrics)
+  {
+    fprintf(output, "%s    {\"name\": ", separator);
+    WriteJsonString(output, metric.name);
+    fprintf(output, ", \"value\": %.3f, \"unit\": ", metric.value);
+    WriteJsonString(output, metric.unit);
+    fprintf(output, "}");
+    separator = ",\n";
+  }
+  fprintf(output, "\n  ]\n}\n");
+
+  fclose(output);
+  return true;
+}
@@ -0,0 +1,243 @@
+#ifndef TEST_RESULTS_H
+#define TEST_RESULTS_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "frame-histogram.h"
+#include "memory-sampler.h"
+#include "perf-counters.h"
+
+/**
+ * @brief The result of one image comparison of a visual test.
+ */
+struct StepResult {
+  int stepIndex;          ///< The index of the step, starting from 1
+  std::string stepName;   ///< The name of the step
+  std::string golden;     ///< The expected image
+  std::string output;     ///< The captured image
+  float similarity[3];    ///< The SSIM of the R, G and B channels
+  float threshold;        ///< The threshold of the comparison
+  bool passed;            ///< Whether all the channels reach the threshold
+  double durationMs;      ///< The time from the start of the step
+  double frameMs;         ///< The mean frame time while waiting for capture
+  int attempt;            ///< 0 for the first capture, N for the Nth retry
+  bool retried;           ///< Whether it has been superseded by a retry
+};
+
+/**
+ * @brief A step of a visual test which has failed without a comparison, e.g.
+ * because it has given up waiting for its conditions.
+ */
+struct StepFailure {
+  int stepIndex;        ///< The index of the step, starting from 1
+  std::string stepName; ///< The name of the step
+  std::string reason;   ///< Why the step has failed
+};
+
+/**
+ * @brief The duration of one step of a visual test, whether or not it has
+ * captured the window.
+ */
+struct StepTiming {
+  int stepIndex;        ///< The index of the step, starting from 1
+  std::string stepName; ///< The name of the step
+  double durationMs;    ///< The time from the start to the end of the step
+};
+
+/**
+ * @brief The memory of one step of a visual test.
+ */
+struct StepMemory {
+  int stepIndex;        ///< The index of the step, starting from 1
+  std::string stepName; ///< The name of the step
+  MemorySample start;   ///< The memory when the step began
+  MemorySample end;     ///< The memory when the step ended
+  uint64_t peakRssKb;   ///< The peak resident set size during the step
+  int64_t retainedKb;   ///< The memory the step has not released
+  bool overBudget;      ///< Whether the retained memory exceeds the budget
+};
+
+/**
+ * @brief The hardware counters of one step of a visual test.
+ */
+struct StepCounters {
+  int stepIndex;             ///< The index of the step, starting from 1
+  std::string stepName;      ///< The name of the step
+  PerfCounterValues step;    ///< The counters of the whole step
+  PerfCounterValues compare; ///< The counters of its image comparisons
+};
+
+/**
+ * @brief The frame times of one window for the whole test run.
+ */
+struct WindowFrames {
+  int windowIndex;           ///< The index of the window, in probing order
+  FrameTimeSummary latency;  ///< From event processing to frame presented
+  FrameTimeSummary interval; ///< Between two consecutive frames
+  uint64_t dropped;          ///< The vsync periods missed between frames
+  uint64_t idleGaps;         ///< The intervals too long to count as frames
+};
+
+/**
+ * @brief A measure reported by a test, e.g. by a benchmark.
+ */
+struct TestMetric {
+  std::string name; ///< The name of the measure
+  double value;     ///< The value of the measure
+  std::string unit; ///< The unit of the value, e.g. "ms"
+};
+
+/**
+ * @brief The table of the comparisons done by a visual test.
+ *
+ * The table can be written as JSON while the event thread is still running
+ * (e.g. by the watchdog), so all the functions are thread safe.
+ */
+class TestResults {
+public:
+  /**
+   * @brief Add the result of a comparison.
+   * @param[in] result The result of the comparison
+   */
+  void Add(const StepResult &result);
+
+  /**
+   * @brief Mark the last comparison as superseded by a new capture of the
+   * same step, so that it does not count in the result of the test.
+   */
+  void MarkLastRetried();
+
+  /**
+   * @brief Add the failure of a step, which fails the test.
+   * @param[in] failure The failure of the step
+   */
+  void AddFailure(const StepFailure &failure);
+
+  /**
+   * @brief Add the duration of a step.
+   * @param[in] timing The duration of the step
+   */
+  void AddTiming(const StepTiming &timing);
+
+  /**
+   * @brief Add the memory of a step.
+   * @param[in] memory The memory of the step
+   */
+  void AddMemory(const StepMemory &memory);
+
+  /**
+   * @brief Add the hardware counters of a step.
+   * @param[in] counters The counters of the step
+   */
+  void AddCounters(const StepCounters &counters);
+
+  /**
+   * @brief Add the frame times of a window.
+   * @param[in] frames The frame times of the window
+   */
+  void AddFrames(const WindowFrames &frames);
+
+  /**
+   * @brief Add a measure reported by the test.
+   * @param[in] name The name of the measure
+   * @param[in] value The value of the measure
+   * @param[in] unit The unit of the value
+   */
+  void AddMetric(const std::string &name, double value,
+                 const std::string &unit);
+
+  /**
+   * @brief Get the number of comparisons in the table.
+   */
+  size_t GetCount() const;
+
+  /**
+   * @brief Get a copy of the comparisons.
+   */
+  std::vector<StepResult> GetResults() const;
+
+  /**
+   * @brief Get a copy of the durations of the steps.
+   */
+  std::vector<StepTiming> GetTimings() const;
+
+  /**
+   * @brief Get a copy of the memory of the steps.
+   */
+  std::vector<StepMemory> GetMemory() const;
+
+  /**
+   * @brief Get a copy of the measures reported by the test.
+   */
+  std::vector<TestMetric> GetMetrics() const;
+
+  /**
+   * @brief Check whether a step or a comparison which has not been retried
+   * has failed.
+   */
+  bool HasFailure() const;
+
+  /**
+   * @brief Get the exit value of the test from the comparisons and the
+   * failures of the steps.
+   * @param[in] defaultValue The exit value if there are neither comparisons
+   * nor failures
+   * @return 0 if every comparison which counts has passed and no step has
+   * failed, 1 if a step has failed, otherwise the average similarity in
+   * percent of the worst failed comparison (at least 1)
+   */
+  int GetExitValue(int defaultValue) const;
+
+  /**
+   * @brief Write the table as JSON.
+   * @param[in] fileName The file to write to
+   * @param[in] testName The name of the test
+   * @param[in] complete Whether the test has finished, false if it is
+   * written before the test has had a chance to run all its steps
+   * @param[in] exitValue The exit value of the test
+   * @return True if the file has been written
+   */
+  bool Write(const std::string &fileName, const std::string &testName,
+             bool complete, int exitValue) const;
+
+private:
+  mutable std::mutex mMutex;
+  std::vector<StepResult> mResults;
+  std::vector<StepFailure> mFailures;
+  std::vector<StepTiming> mTimings;
+  std::vector<StepMemory> mMemory;
+  std::vector<StepCounters> mCounters;
+  std::vector<WindowFrames> mFrames;
+  std::vector<TestMetric> mMetrics;
+};
+
+/**
+ * @brief Write a string as a JSON string literal, with its quotes.
+ * @param[in] output The file to write to
+ * @param[in] value The string
+ */
+void WriteJsonString(FILE *output, const std::string &value);
+
+#endif // TEST_RESULTS_H
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "thread-pool.h"
+
+// EXTERNAL INCLUDES
+#include <sched.h>
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include "allocation-counter.h"
+
+unsigned GetAvailableCpuCount()
+{
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  if(sched_getaffinity(0, sizeof(cpus), &cpus) == 0)
+  {
+    return std::max(1, CPU_COUNT(&cpus));
+  }
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+ThreadPool::AllocationScope::AllocationScope(std::atomic<uint64_t>& allocations)
+: mAllocations(allocations),
+  mStart(GetThreadAllocationCount())
+{
+}
+
+ThreadPool::AllocationScope::~AllocationScope()
+{
+  mAllocations += GetThreadAllocationCount() - mStart;
+}
+
+ThreadPool::ThreadPool(unsigned threadCount)
+: mAllocations(0u),
+  mStopping(false)
+{
+  for(unsigned i = 0u; i < std::max(1u, threadCount); ++i)
+  {
+    mWorkers.emplace_back(&ThreadPool::Work, this);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStopping = true;
+  }
+  mCondition.notify_all();
+  for(auto& worker : mWorkers)
+  {
+    worker.join();
+  }
+}
+
+void ThreadPool::Push(std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mTasks.push_back(std::move(task));
+  }
+  mCondition.notify_one();
+}
+
+uint64_t ThreadPool::GetAllocationCount() const
+{
+  return mAllocations.load();
+}
+
+void ThreadPool::Work()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  while(true)
+  {
+    mCondition.wait(lock, [this]() { return mStopping || !mTasks.empty(); });
+    if(mTasks.empty())
+    {
+      return; // Stopping, and every task has run
+    }
+
+    std::function<void()> task = std::move(mTasks.front());
+    mTasks.pop_front();
+    lock.unlock();
+
+    task(); // The exception of the task, if any, is stored in its future
+
+    lock.lock();
+  }
+}
@@ -0,0 +1,117 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Get the number of CPUs the process may run on, i.e. those of
+ * --cpus if it is pinned.
+ */
+unsigned GetAvailableCpuCount();
+
+/**
+ * @brief A fixed set of worker threads which run the tasks submitted to it in
+ * order.
+ *
+ * The allocations made by the tasks are counted for the pool, since those of
+ * the workers are not those of the event thread (see
+ * GetThreadAllocationCount).
+ */
+class ThreadPool {
+public:
+  /**
+   * @brief Constructor. Starts the workers.
+   * @param[in] threadCount The number of workers, at least 1
+   */
+  explicit ThreadPool(unsigned threadCount);
+
+  /**
+   * @brief Destructor. Runs the tasks already submitted, then stops the
+   * workers.
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /**
+   * @brief Submit a task to the workers.
+   * @param[in] task The task, which returns the result of the future
+   * @return The future of the task, which holds its result or the exception
+   * it has thrown
+   */
+  template <typename Task>
+  auto Submit(Task task) -> std::future<decltype(task())> {
+    using Result = decltype(task());
+
+    // The allocations are counted when the task returns, before the future is
+    // ready
+    auto packagedTask = std::make_shared<std::packaged_task<Result()>>(
+        [this, task = std::move(task)]() mutable {
+          AllocationScope scope(mAllocations);
+          return task();
+        });
+    std::future<Result> future = packagedTask->get_future();
+    Push([packagedTask]() { (*packagedTask)(); });
+    return future;
+  }
+
+  /**
+   * @brief Get the number of allocations made by the tasks so far.
+   */
+  uint64_t GetAllocationCount() const;
+
+private:
+  /**
+   * @brief Add the allocations of the worker from its construction to its
+   * destruction to the count of the pool.
+   */
+  class AllocationScope {
+  public:
+    explicit AllocationScope(std::atomic<uint64_t> &allocations);
+    ~AllocationScope();
+
+  private:
+    std::atomic<uint64_t> &mAllocations;
+    uint64_t mStart;
+  };
+
+  void Push(std::function<void()> task);
+  void Work();
+
+  std::mutex mMutex;
+  std::condition_variable mCondition;
+  std::deque<std::function<void()>> mTasks;
+  std::vector<std::thread> mWorkers;
+  std::atomic<uint64_t> mAllocations;
+  bool mStopping;
+};
+
+#endif // THREAD_POOL_H
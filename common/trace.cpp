@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "trace.h"
+
+// EXTERNAL INCLUDES
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+bool gTraceEnabled = false;
+
+namespace
+{
+struct TraceEvent
+{
+  const char* name;
+  char        detail[48];
+  int64_t     start;    ///< In microseconds of the monotonic clock
+  int64_t     duration; ///< In microseconds
+  uint32_t    threadId;
+  int         step;
+};
+
+TraceEvent            gTraceEvents[TRACE_BUFFER_SIZE];
+std::atomic<uint64_t> gTraceEventCount{0u};
+
+int64_t Microseconds(TraceClock::time_point time)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+}
+
+uint32_t CurrentThreadId()
+{
+  thread_local uint32_t threadId = static_cast<uint32_t>(syscall(SYS_gettid));
+  return threadId;
+}
+} // namespace
+
+void TraceSpan(const char* name, TraceClock::time_point start, TraceClock::time_point end, int step, const std::string& detail)
+{
+  if(!gTraceEnabled)
+  {
+    return;
+  }
+
+  // Claim a slot without locking, the event thread must not wait for the watchdog
+  TraceEvent& event = gTraceEvents[gTraceEventCount.fetch_add(1u, std::memory_order_relaxed) % TRACE_BUFFER_SIZE];
+  event.name        = name;
+  event.start       = Microseconds(start);
+  event.duration    = std::max<int64_t>(0, Microseconds(end) - event.start);
+  event.threadId    = CurrentThreadId();
+  event.step        = step;
+
+  // The detail is written as is in the JSON, so the characters which would need escaping are replaced
+  size_t length = std::min(detail.size(), sizeof(event.detail) - 1u);
+  for(size_t i = 0; i < length; ++i)
+  {
+    const unsigned char c = detail[i];
+    event.detail[i]       = (c == '"' || c == '\\' || c < 0x20) ? '_' : c;
+  }
+  event.detail[length] = '\0';
+}
+
+TraceScope::TraceScope(const char* name, int step)
+: mName(name),
+  mStep(step)
+{
+  if(gTraceEnabled)
+  {
+    mStart = TraceClock::now();
+  }
+}
+
+TraceScope::~TraceScope()
+{
+  if(gTraceEnabled)
+  {
+    TraceSpan(mName, mStart, TraceClock::now(), mStep);
+  }
+}
+
+bool WriteTrace(const std::string& fileName, const std::string& processName)
+{
+  FILE* output = fopen(fileName.c_str(), "w");
+  if(!output)
+  {
+    fprintf(stderr, "Unable to open the trace file %s\n", fileName.c_str());
+    return false;
+  }
+
+  const uint64_t total   = gTraceEventCount.load();
+  const uint64_t count   = std::min<uint64_t>(total, TRACE_BUFFER_SIZE);
+  const pid_t    process = getpid();
+
+  fprintf(output, "{\"traceEvents\": [\n");
+  fprintf(output, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %d, \"tid\": 0, \"args\": {\"name\": \"%s\", \"dropped\": %llu}}", process, processName.c_str(), static_cast<unsigned long long>(total - count));
+
+  for(uint64_t i = total - count; i < total; ++i)
+  {
+    const TraceEvent& event = gTraceEvents[i % TRACE_BUFFER_SIZE];
+    fprintf(output,
+            ",\n{\"name\": \"%s\", \"cat\": \"harness\", \"ph\": \"X\", \"ts\": %lld, \"dur\": %lld, \"pid\": %d, \"tid\": %u, \"args\": {\"step\": %d, \"detail\": \"%s\"}}",
+            event.name,
+            static_cast<long long>(event.start),
+            static_cast<long long>(event.duration),
+            process,
+            event.threadId,
+            event.step,
+            event.detail);
+  }
+  fprintf(output, "\n],\n\"displayTimeUnit\": \"ms\"}\n");
+
+  fclose(output);
+  return true;
+}
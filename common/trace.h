@@ -0,0 +1,90 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <string>
+
+// The number of spans kept by the trace, the oldest ones are overwritten
+#define TRACE_BUFFER_SIZE 16384u
+
+/**
+ * @brief Whether the spans are recorded, i.e. --trace. Nothing is recorded
+ * otherwise, so the spans cost a single check.
+ */
+extern bool gTraceEnabled;
+
+using TraceClock = std::chrono::steady_clock;
+
+/**
+ * @brief Record a span of the harness in the trace.
+ *
+ * The spans are kept in a ring buffer which is written in the Chrome
+ * trace-event format (see WriteTrace), so they can be viewed in
+ * chrome://tracing or Perfetto. The times are taken from the monotonic clock,
+ * which is shared by all the processes, so the traces of several tests can be
+ * merged into one timeline.
+ *
+ * @param[in] name The name of the span, which must be a string literal
+ * @param[in] start The time at which the span started
+ * @param[in] end The time at which the span ended
+ * @param[in] step The index of the step of the test, or 0
+ * @param[in] detail A description of the span, e.g. the name of the step
+ */
+void TraceSpan(const char *name, TraceClock::time_point start,
+               TraceClock::time_point end, int step = 0,
+               const std::string &detail = std::string());
+
+/**
+ * @brief Record a span from its construction to its destruction.
+ */
+class TraceScope {
+public:
+  /**
+   * @brief Constructor.
+   * @param[in] name The name of the span, which must be a string literal
+   * @param[in] step The index of the step of the test, or 0
+   */
+  explicit TraceScope(const char *name, int step = 0);
+
+  /**
+   * @brief Destructor. Records the span.
+   */
+  ~TraceScope();
+
+private:
+  const char *mName;
+  int mStep;
+  TraceClock::time_point mStart;
+};
+
+/**
+ * @brief Write the recorded spans as Chrome trace-event JSON.
+ *
+ * Every span is written on its own line starting with {"name", so that the
+ * runner can merge the traces of all the tests with line-based tools.
+ *
+ * @param[in] fileName The file to write
+ * @param[in] processName The name of the process in the timeline
+ * @return Whether the file has been written
+ */
+bool WriteTrace(const std::string &fileName, const std::string &processName);
+
+#endif // TRACE_H
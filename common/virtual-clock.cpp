@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "virtual-clock.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+using namespace Dali;
+
+bool gVirtualClock = false;
+
+bool VirtualClock::IsEnabled()
+{
+  return gVirtualClock;
+}
+
+VirtualClock::Entry& VirtualClock::GetEntry(Animation animation)
+{
+  auto iter = std::find_if(mEntries.begin(), mEntries.end(), [&animation](const Entry& entry) { return entry.animation == animation; });
+  if(iter == mEntries.end())
+  {
+    mEntries.push_back(Entry{animation, 0.0f, false});
+    return mEntries.back();
+  }
+  return *iter;
+}
+
+void VirtualClock::Play(Animation animation)
+{
+  if(!gVirtualClock)
+  {
+    animation.Play();
+    return;
+  }
+
+  // The animation is applied at the progress set by Wait() while it is paused
+  Entry& entry  = GetEntry(animation);
+  entry.playing = true;
+  animation.Play();
+  animation.Pause();
+  animation.SetCurrentProgress(std::min(1.0f, entry.elapsedSeconds / animation.GetDuration()));
+}
+
+void VirtualClock::PlayToEnd(Animation animation)
+{
+  if(!gVirtualClock)
+  {
+    animation.Play();
+    return;
+  }
+
+  animation.Play();
+  animation.Pause();
+  animation.SetCurrentProgress(1.0f);
+  animation.Stop(); // Bakes the end values and emits the FinishedSignal
+
+  mEntries.erase(std::remove_if(mEntries.begin(), mEntries.end(), [&animation](const Entry& entry) { return entry.animation == animation; }), mEntries.end());
+}
+
+void VirtualClock::Pause(Animation animation)
+{
+  if(!gVirtualClock)
+  {
+    animation.Pause();
+    return;
+  }
+
+  GetEntry(animation).playing = false;
+}
+
+void VirtualClock::Wait(uint32_t milliseconds, std::function<void()> callback)
+{
+  mCallback = callback;
+
+  if(!gVirtualClock)
+  {
+    mTimer = Timer::New(milliseconds);
+    mTimer.TickSignal().Connect(this, &VirtualClock::OnTimer);
+    mTimer.Start();
+    return;
+  }
+
+  std::vector<Animation> finished;
+  for(auto& entry : mEntries)
+  {
+    if(!entry.playing)
+    {
+      continue;
+    }
+
+    const float duration = entry.animation.GetDuration();
+    entry.elapsedSeconds += entry.animation.GetSpeedFactor() * milliseconds / 1000.0f;
+    if(entry.elapsedSeconds >= duration)
+    {
+      finished.push_back(entry.animation);
+    }
+    else
+    {
+      entry.animation.SetCurrentProgress(entry.elapsedSeconds / duration);
+    }
+  }
+
+  for(auto& animation : finished)
+  {
+    PlayToEnd(animation);
+  }
+
+  // A zero duration animation finishes once the next frame has been updated
+  mFrameAnimation = Animation::New(0);
+  mFrameAnimation.FinishedSignal().Connect(this, &VirtualClock::OnFrameUpdated);
+  mFrameAnimation.Play();
+}
+
+bool VirtualClock::OnTimer()
+{
+  OnFrameUpdated(Animation());
+  return false;
+}
+
+void VirtualClock::OnFrameUpdated(Animation /* not used */)
+{
+  auto callback = std::move(mCallback);
+  mCallback     = nullptr;
+  if(callback)
+  {
+    callback();
+  }
+}
@@ -0,0 +1,110 @@
+#ifndef VIRTUAL_CLOCK_H
+#define VIRTUAL_CLOCK_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/dali.h>
+#include <functional>
+#include <vector>
+
+extern bool gVirtualClock;
+
+/**
+ * @brief Plays the animations of a test against either the real clock or a
+ * virtual clock driven by the test (--virtual-clock).
+ *
+ * With the real clock, the functions are equivalent to playing and pausing
+ * the animations and waiting with a Dali::Timer.
+ *
+ * With the virtual clock, the animations played through this class are kept
+ * paused and their progress is set by Wait(), so that "advance by 250 ms,
+ * then render" takes a single frame and always renders the same state of the
+ * animations, regardless of the speed of the machine.
+ *
+ * @code
+ * mClock.Play(mAnimation);
+ * mClock.Wait(250u, [this]() { CaptureWindowAfterFrameRendered(window); });
+ * @endcode
+ */
+class VirtualClock : public Dali::ConnectionTracker {
+public:
+  /**
+   * @brief Check whether the virtual clock is used, i.e. --virtual-clock.
+   */
+  static bool IsEnabled();
+
+  /**
+   * @brief Play the animation, or resume it if it has been paused.
+   * @param[in] animation The animation to play
+   */
+  void Play(Dali::Animation animation);
+
+  /**
+   * @brief Play the animation until its end.
+   *
+   * With the virtual clock, the animation is moved to its end in the next
+   * frame, and its FinishedSignal is emitted as usual.
+   *
+   * @param[in] animation The animation to play
+   */
+  void PlayToEnd(Dali::Animation animation);
+
+  /**
+   * @brief Pause the animation.
+   * @param[in] animation The animation to pause
+   */
+  void Pause(Dali::Animation animation);
+
+  /**
+   * @brief Call the given function once the given time has passed.
+   *
+   * With the virtual clock, the time passes for the animations played
+   * through this class only, and the function is called once the frame
+   * showing them at the new time has been updated. The animations which
+   * reach their end are stopped, which emits their FinishedSignal.
+   *
+   * @param[in] milliseconds The time to wait
+   * @param[in] callback The function to call, it replaces the one of a
+   * previous Wait which has not completed yet
+   */
+  void Wait(uint32_t milliseconds, std::function<void()> callback);
+
+private:
+  struct Entry {
+    Dali::Animation animation;
+    float elapsedSeconds; ///< The virtual time played, at normal speed
+    bool playing;
+  };
+
+  /**
+   * @brief Find the entry of the given animation, adding it if required.
+   */
+  Entry &GetEntry(Dali::Animation animation);
+
+  bool OnTimer();
+  void OnFrameUpdated(Dali::Animation animation);
+
+private:
+  std::vector<Entry> mEntries;
+  std::function<void()> mCallback;
+  Dali::Timer mTimer;
+  Dali::Animation mFrameAnimation; ///< Completes after the next update
+};
+
+#endif // VIRTUAL_CLOCK_H
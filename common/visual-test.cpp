@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,6 +27,8 @@
 #if defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
+#include "scene-loader.h"
+#include "shader-cache.h"
 
 #include <dali/devel-api/adaptor-framework/bitmap-saver.h>
 #include <dali/integration-api/debug.h>
@@ -38,8 +40,12 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <cerrno>
+#include <algorithm>
+#include <cinttypes>
+#include <climits>
 #include <cstdio>
 #include <filesystem>
+#include <mutex>
 
 using namespace Dali;
 namespace fs = std::filesystem;
@@ -50,9 +56,109 @@ const char* gVirtualFramebuffer = "/var/tmp/Xvfb_screen0";
 bool        gFB                 = false;
 int         gExitValue          = 1;
 int         gImageNumber        = 1;
+int         gMaxRetries         = 0;
+const char* gTestName           = "";
+uint32_t    gStepTimeout        = DEFAULT_STEP_TIMEOUT;
+std::string gHeartbeatFile;
+std::string gResultsFile;
+bool        gFailFast = false;
+std::string gTraceFile;
+uint64_t    gMemoryBudget = 0u; // In kB, 0 for no budget
+std::string gPerfBaselineFile;  // The installed baseline of the test by default
+std::string gPerfGate;          // The gate of the baseline file by default
+int         gInstanceCount = 0; // From --instances, 0 for the numbers of instances of the benchmark
 
-bool ParseEnvironment(int argc, char** argv, int WindowWidth, int WindowHeight)
+#ifdef SURFACELESS_DEFAULT
+bool gSurfaceless = true; // Built for an adaptor without a display server
+#else
+bool gSurfaceless = false;
+#endif
+
+// The time at which the test executable started, the beginning of the startup span
+TraceClock::time_point gStartupTime;
+
+namespace
+{
+// The options which name the outputs of a run, with the number of values they take, which are not passed to a child run
+const std::pair<const char*, int> OUTPUT_OPTIONS[] = {
+  {"--results", 1},
+  {"--trace", 1},
+  {"--heartbeat", 1},
+};
+
+std::vector<std::string> gChildRunArguments;
+
+/**
+ * @brief Make the test render with a surfaceless EGL display, without any
+ * display server. The captures are then always taken from the offscreen
+ * frame buffer.
+ */
+void SetupSurfaceless()
+{
+  if(gFB)
+  {
+    printf("--fb reads the framebuffer of Xvfb, the captures are taken offscreen with --surfaceless\n");
+    gFB = false;
+  }
+
+  // Mesa picks its platform and driver from the environment, unless they have been chosen already
+  setenv("EGL_PLATFORM", "surfaceless", 0);
+  setenv("LIBGL_ALWAYS_SOFTWARE", "1", 0);
+
+  // A backend which still needed X would fail at once rather than use an X server which happens to be there
+  unsetenv("DISPLAY");
+}
+} // namespace
+
+bool ParseEnvironment(int argc, char** argv, const VisualTestMetadata& metadata)
 {
+  gStartupTime = TraceClock::now();
+  MarkStartupPhase(STARTUP_MAIN);
+
+  int         repeat = 0;
+  std::string buildToCompare;
+  std::string cpuList;
+  std::string shaderCacheDir;
+  bool        shaderCache = true;
+
+  std::string              baselineToWrite;
+  std::vector<std::string> baselineRuns;
+
+  // The executable is named after the directory of the test, e.g. scene3d.test
+  std::string testDirectory = fs::path(argv[0]).filename().string();
+  if(testDirectory.size() > 5u && testDirectory.compare(testDirectory.size() - 5u, 5u, ".test") == 0)
+  {
+    testDirectory.resize(testDirectory.size() - 5u);
+  }
+  gPerfBaselineFile = TestImagePath(testDirectory + "/" PERF_BASELINE_FILE);
+
+  if(metadata.stepTimeout > 0u)
+  {
+    gStepTimeout = metadata.stepTimeout;
+  }
+
+  for(int c = 1; c < argc;)
+  {
+    int skip = 0;
+    for(const auto& option : OUTPUT_OPTIONS)
+    {
+      if(!strcmp(argv[c], option.first))
+      {
+        skip = 1 + option.second;
+      }
+    }
+
+    if(skip > 0)
+    {
+      c += skip;
+    }
+    else
+    {
+      gChildRunArguments.push_back(argv[c]);
+      ++c;
+    }
+  }
+
   int c = 1;
   while(c < argc)
   {
@@ -63,9 +169,160 @@ bool ParseEnvironment(int argc, char** argv, int WindowWidth, int WindowHeight)
     }
     else if(!strcmp(argv[c], "--get-dimensions"))
     {
-      printf("%dx%dx24\n", WindowWidth, WindowHeight);
+      // The runner reads the metadata section instead, this is kept for older runners
+      printf("%ux%ux24\n", metadata.windowWidth, metadata.windowHeight);
       return false;
     }
+    else if(!strcmp(argv[c], "--retries"))
+    {
+      if(c + 1 < argc)
+      {
+        gMaxRetries = std::max(0, atoi(argv[c + 1]));
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--step-timeout"))
+    {
+      if(c + 1 < argc)
+      {
+        gStepTimeout = strtoul(argv[c + 1], nullptr, 10);
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--instances"))
+    {
+      char*      end   = nullptr;
+      const long count = c + 1 < argc ? strtol(argv[c + 1], &end, 10) : 0;
+      if(!end || *end != '\0' || count < 1 || count > INT_MAX)
+      {
+        fprintf(stderr, "--instances takes a number of instances from 1, not %s\n", c + 1 < argc ? argv[c + 1] : "nothing");
+        exit(EXIT_FAILURE);
+      }
+      gInstanceCount = static_cast<int>(count);
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--heartbeat"))
+    {
+      if(c + 1 < argc)
+      {
+        gHeartbeatFile = argv[c + 1];
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--results"))
+    {
+      if(c + 1 < argc)
+      {
+        gResultsFile = argv[c + 1];
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--surfaceless"))
+    {
+      gSurfaceless = true;
+      ++c;
+    }
+    else if(!strcmp(argv[c], "--virtual-clock"))
+    {
+      gVirtualClock = true;
+      ++c;
+    }
+    else if(!strcmp(argv[c], "--fail-fast"))
+    {
+      gFailFast = true;
+      ++c;
+    }
+    else if(!strcmp(argv[c], "--perf-counters"))
+    {
+      gPerfCounters = true;
+      ++c;
+    }
+    else if(!strcmp(argv[c], "--repeat"))
+    {
+      if(c + 1 < argc)
+      {
+        repeat = std::max(0, atoi(argv[c + 1]));
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--compare-with"))
+    {
+      if(c + 1 < argc)
+      {
+        buildToCompare = argv[c + 1];
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--cpus"))
+    {
+      if(c + 1 < argc)
+      {
+        cpuList = argv[c + 1];
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--perf-baseline"))
+    {
+      if(c + 1 < argc)
+      {
+        gPerfBaselineFile = argv[c + 1];
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--perf-gate"))
+    {
+      if(c + 1 < argc)
+      {
+        gPerfGate = argv[c + 1];
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--write-perf-baseline"))
+    {
+      if(c + 1 < argc)
+      {
+        baselineToWrite = argv[c + 1];
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--baseline-run"))
+    {
+      if(c + 1 < argc)
+      {
+        baselineRuns.push_back(argv[c + 1]);
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--memory-budget"))
+    {
+      if(c + 1 < argc)
+      {
+        gMemoryBudget = strtoull(argv[c + 1], nullptr, 10);
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--trace"))
+    {
+      if(c + 1 < argc)
+      {
+        gTraceFile    = argv[c + 1];
+        gTraceEnabled = true;
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--shader-cache"))
+    {
+      if(c + 1 < argc)
+      {
+        shaderCacheDir = argv[c + 1];
+      }
+      c += 2;
+    }
+    else if(!strcmp(argv[c], "--no-shader-cache"))
+    {
+      shaderCache = false;
+      ++c;
+    }
     else if(!strcmp(argv[c], "--directory"))
     {
       if(c + 1 < argc)
@@ -79,15 +336,396 @@ bool ParseEnvironment(int argc, char** argv, int WindowWidth, int WindowHeight)
       ++c; //ignore unknown args
     }
   }
+
+  // The baseline is written from the results of earlier runs, the test itself does not run
+  if(!baselineToWrite.empty())
+  {
+    exit(PerfBaseline::Write(baselineToWrite, baselineRuns) ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
+
+  // Before Application::New, which opens the EGL display
+  if(gSurfaceless)
+  {
+    SetupSurfaceless();
+  }
+
+  // Before Application::New as well, which loads the GL driver
+  if(shaderCache)
+  {
+    SetupShaderCache(shaderCacheDir);
+  }
+  else
+  {
+    DisableShaderCache();
+  }
+
+  // Before any thread is created, so that the threads of DALi and the runs of --repeat are pinned too
+  if(!cpuList.empty())
+  {
+    PinToCpus(cpuList);
+  }
+
+  if(repeat > 0)
+  {
+    RepeatRunner runner(argc, argv);
+    if(!buildToCompare.empty())
+    {
+      runner.SetBuildToCompare(buildToCompare);
+    }
+    exit(runner.Run(repeat));
+  }
   return true;
 }
 
+const std::vector<std::string>& GetChildRunArguments()
+{
+  return gChildRunArguments;
+}
+
 /**
  * @brief Constructor.
  */
 VisualTest::VisualTest()
-: mWindow()
+: mWindow(),
+  mRetryCount(0),
+  mRetryRequested(false),
+  mStepIndex(0),
+  mStepImplicit(false),
+  mStepDropped(false),
+  mCaptureStage(0),
+  mExpectedResourceCount(0),
+  mResourceReadyCount(0),
+  mCaptureFrameMs(-1.0),
+  mFinished(false)
+{
+  // The DALI_VISUAL_TEST* macros construct the test right after Application::New
+  MarkStartupPhase(STARTUP_APPLICATION_NEW);
+
+  if(gPerfCounters)
+  {
+    mPerfCounters.Open();
+  }
+  mWatchdog.Start(gTestName, gHeartbeatFile, [this](FILE* output) { DumpState(output); });
+  BeginStep(std::string());
+}
+
+VisualTest::~VisualTest()
+{
+  mWatchdog.Stop();
+  FinishTest();
+  WriteResults(true);
+  WriteTraceFile();
+}
+
+void VisualTest::SetApplication(Dali::Application application)
+{
+  mTestApplication = application;
+  mTestApplication.TerminateSignal().Connect(this, &VisualTest::OnTerminate);
+}
+
+void VisualTest::OnTerminate(Dali::Application& /* not used */)
+{
+  FinishTest();
+}
+
+void VisualTest::FinishTest()
+{
+  if(mFinished)
+  {
+    return;
+  }
+  mFinished = true;
+
+  // The step which began by itself after the last capture is empty unless the test has done something in it
+  if(mStepImplicit)
+  {
+    mStepDropped = true;
+  }
+  else
+  {
+    EndStepTiming();
+    EndStepMemory();
+    EndStepCounters();
+  }
+  EndFrameProbes();
+  EndShaderCache();
+  CheckPerfBaseline();
+}
+
+void VisualTest::ProbeFrames(Dali::Window window)
+{
+  if(!window || mFinished)
+  {
+    return;
+  }
+  for(const auto& probe : mFrameProbes)
+  {
+    if(probe->IsProbing(window))
+    {
+      return;
+    }
+  }
+
+  mFrameProbes.push_back(std::make_unique<FrameProbe>(window, static_cast<int>(mFrameProbes.size()) + 1));
+  mFrameProbes.back()->Attach();
+}
+
+void VisualTest::EndFrameProbes()
+{
+  for(const auto& probe : mFrameProbes)
+  {
+    probe->Detach();
+
+    const WindowFrames frames = probe->GetFrames();
+    mResults.AddFrames(frames);
+    printf("FRAMES: %s window %d latency p50 %.2f p90 %.2f p99 %.2f max %.2f ms, interval p50 %.2f p90 %.2f p99 %.2f max %.2f ms, %" PRIu64 " interval(s), %" PRIu64 " dropped\n",
+           gTestName,
+           frames.windowIndex,
+           frames.latency.p50Ms,
+           frames.latency.p90Ms,
+           frames.latency.p99Ms,
+           frames.latency.maxMs,
+           frames.interval.p50Ms,
+           frames.interval.p90Ms,
+           frames.interval.p99Ms,
+           frames.interval.maxMs,
+           frames.interval.count,
+           frames.dropped);
+  }
+  fflush(stdout);
+}
+
+void VisualTest::EndShaderCache()
+{
+  // While DALi is still running, the shaders and the environment maps of the scenes are released with it
+  ReleaseSharedSceneResources();
+
+  const ShaderCacheCounts counts = GetShaderCacheCounts();
+  if(counts.programsSeenBefore + counts.programsNew > 0u)
+  {
+    ReportMetric("shader-cache.programs-seen-before", counts.programsSeenBefore, "count");
+    ReportMetric("shader-cache.programs-new", counts.programsNew, "count");
+    ReportMetric("shader-cache.driver-new-files", counts.driverNewFiles, "count");
+    ReportMetric("shader-cache.driver-new-size", counts.driverNewBytes / 1024.0, "kB");
+  }
+  SaveShaderCache();
+}
+
+void VisualTest::CheckPerfBaseline()
 {
+  PerfBaseline baseline;
+  if(gPerfBaselineFile.empty() || !baseline.Load(gPerfBaselineFile))
+  {
+    return;
+  }
+
+  const PerfGate gate = PerfBaseline::ParseGate(gPerfGate, baseline.GetGate());
+  if(gate == PerfGate::OFF)
+  {
+    return;
+  }
+
+  const int regressions = baseline.Check(mResults, stdout);
+  if(regressions > 0 && gate == PerfGate::FAIL && gExitValue == 0)
+  {
+    // A visual failure is reported first, it says more than the timings
+    gExitValue = PERF_REGRESSION_EXIT_VALUE;
+  }
+}
+
+void VisualTest::OnInitStarted(Dali::Application& application)
+{
+  MarkStartupPhase(STARTUP_INIT_SIGNAL);
+  mInitStartTime = TraceClock::now();
+  TraceSpan("startup", gStartupTime, mInitStartTime);
+  ProbeFrames(application.GetWindow());
+}
+
+void VisualTest::OnInitFinished(Dali::Application& /* not used */)
+{
+  TraceSpan("OnInit", mInitStartTime, TraceClock::now());
+}
+
+void VisualTest::WriteTraceFile()
+{
+  if(gTraceFile.empty())
+  {
+    return;
+  }
+
+  // This is also called from the watchdog thread, while BeginStep may change the step
+  int                                   stepIndex;
+  std::string                           stepName;
+  std::chrono::steady_clock::time_point stepStartTime;
+  {
+    std::lock_guard<std::mutex> lock(mStepMutex);
+    stepIndex     = mStepIndex;
+    stepName      = mStepName;
+    stepStartTime = mStepStartTime;
+  }
+
+  if(!mStepDropped)
+  {
+    TraceSpan("step", stepStartTime, TraceClock::now(), stepIndex, stepName);
+  }
+  if(WriteTrace(gTraceFile, gTestName))
+  {
+    printf("TRACE: %s\n", gTraceFile.c_str());
+    fflush(stdout);
+  }
+}
+
+void VisualTest::WriteResults(bool complete)
+{
+  std::string fileName = gResultsFile;
+  if(fileName.empty() && gTempFilename)
+  {
+    fileName = std::string(gTempFilename) + "-results.json";
+  }
+
+  if(!fileName.empty() && fs::exists(fs::path(gTempDir)) && mResults.Write(fileName, gTestName, complete, gExitValue))
+  {
+    printf("RESULTS: %s\n", fileName.c_str());
+    fflush(stdout);
+  }
+}
+
+void VisualTest::BeginStep(const std::string& name, uint32_t timeout)
+{
+  if(mStepIndex > 0)
+  {
+    TraceSpan("step", mStepStartTime, TraceClock::now(), mStepIndex, mStepName);
+    EndStepTiming();
+    EndStepMemory();
+    EndStepCounters();
+  }
+
+  mExpectedResourceCount = 0;
+  mResourceReadyCount    = 0;
+
+  TakePeakRss(); // The peak of the new step starts from here
+  mStepStartMemory = SampleMemory();
+
+  if(mPerfCounters.IsOpen())
+  {
+    mCompareCounters   = PerfCounterValues();
+    mStepStartCounters = mPerfCounters.Read();
+  }
+
+  {
+    // The watchdog thread reads the step when it expires (see WriteTraceFile)
+    std::lock_guard<std::mutex> lock(mStepMutex);
+    ++mStepIndex;
+    mStepName      = name.empty() ? "step-" + std::to_string(mStepIndex) : name;
+    mStepStartTime = std::chrono::steady_clock::now();
+  }
+  mStepImplicit = false;
+
+  Debug::LogMessage(Debug::INFO, "Beginning step %d (%s)\n", mStepIndex, mStepName.c_str());
+  mWatchdog.Arm(mStepIndex, mStepName, timeout > 0u ? timeout : gStepTimeout);
+}
+
+void VisualTest::EndStepTiming()
+{
+  StepTiming timing;
+  timing.stepIndex  = mStepIndex;
+  timing.stepName   = mStepName;
+  timing.durationMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mStepStartTime).count();
+  mResults.AddTiming(timing);
+}
+
+void VisualTest::EndStepMemory()
+{
+  StepMemory memory;
+  memory.stepIndex = mStepIndex;
+  memory.stepName  = mStepName;
+  memory.start     = mStepStartMemory;
+  memory.end       = SampleMemory();
+  memory.peakRssKb = TakePeakRss();
+
+  // PSS does not count the pages shared with other processes, so it is preferred when known
+  const bool usePss = memory.start.pssKb > 0u && memory.end.pssKb > 0u;
+  const auto before = usePss ? memory.start.pssKb : memory.start.rssKb;
+  const auto after  = usePss ? memory.end.pssKb : memory.end.rssKb;
+  memory.retainedKb = static_cast<int64_t>(after) - static_cast<int64_t>(before);
+  memory.overBudget = gMemoryBudget > 0u && memory.retainedKb > static_cast<int64_t>(gMemoryBudget);
+  mResults.AddMemory(memory);
+
+  if(memory.overBudget)
+  {
+    printf("MEMORY: %s step %d (%s) retained %" PRId64 " kB, over the budget of %" PRIu64 " kB (peak RSS %" PRIu64 " kB)\n", gTestName, memory.stepIndex, memory.stepName.c_str(), memory.retainedKb, gMemoryBudget, memory.peakRssKb);
+    fflush(stdout);
+  }
+}
+
+void VisualTest::EndStepCounters()
+{
+  if(!mPerfCounters.IsOpen())
+  {
+    return;
+  }
+
+  StepCounters counters;
+  counters.stepIndex = mStepIndex;
+  counters.stepName  = mStepName;
+  counters.step      = mPerfCounters.Read() - mStepStartCounters;
+  counters.compare   = mCompareCounters;
+  mResults.AddCounters(counters);
+}
+
+void VisualTest::SetExpectedResourceCount(int count)
+{
+  mExpectedResourceCount = count;
+  mResourceReadyCount    = 0;
+}
+
+void VisualTest::IncrementResourceReadyCount()
+{
+  ++mResourceReadyCount;
+}
+
+void VisualTest::FailStep(const std::string& reason)
+{
+  StepFailure failure;
+  failure.stepIndex = mStepIndex;
+  failure.stepName  = mStepName;
+  failure.reason    = reason;
+  mResults.AddFailure(failure);
+  mStepImplicit = false;
+
+  printf("FAIL: %s step %d (%s) %s\n", gTestName, failure.stepIndex, failure.stepName.c_str(), reason.c_str());
+  fflush(stdout);
+  gExitValue = mResults.GetExitValue(gExitValue);
+}
+
+bool VisualTest::HasFailure() const
+{
+  return mResults.HasFailure();
+}
+
+void VisualTest::DumpState(FILE* output)
+{
+  const int stage = mCaptureStage;
+  if(stage == 0)
+  {
+    fprintf(output, "  Pending capture: none\n");
+  }
+  else if(stage < 5)
+  {
+    fprintf(output, "  Pending capture: waiting for frame %d of 4\n", stage);
+  }
+  else
+  {
+    fprintf(output, "  Pending capture: waiting for the offscreen render task to finish\n");
+  }
+  fprintf(output, "  Retries of the step: %d of %d\n", mRetryCount.load(), gMaxRetries);
+  fprintf(output, "  Images captured: %d\n", gImageNumber - 1);
+  fprintf(output, "  Resources ready: %d of %d\n", mResourceReadyCount.load(), mExpectedResourceCount.load());
+  fflush(output);
+
+  // Keep the comparisons done so far, the test will not get to its end
+  WriteResults(false);
+  WriteTraceFile();
 }
 
 void VisualTest::SetupOffscreenRenderTask(Dali::Window window, Dali::CameraActor customCamera)
@@ -150,11 +788,41 @@ void VisualTest::OnWindowResized(Dali::Window window, Dali::Window::WindowSize s
   }
 }
 void VisualTest::CaptureWindowAfterFrameRendered(Dali::Window window, Dali::CameraActor customCamera)
+{
+  // A capture requested by the test starts a new step, so it gets a fresh set of retries
+  mRetryCount = 0;
+  RequestCapture(window, customCamera);
+}
+
+bool VisualTest::RetryCapture()
+{
+  // The window may have been deleted since, e.g. a secondary window of the test
+  Dali::Window window = mLastCapturedWindow.GetHandle();
+  if(mRetryCount >= gMaxRetries || !window)
+  {
+    return false;
+  }
+
+  ++mRetryCount;
+  mRetryRequested = true;
+  mResults.MarkLastRetried();
+  printf("RETRY: %s did not match, capturing again (attempt %d of %d)\n", mLastExpectedImage.c_str(), mRetryCount.load(), gMaxRetries);
+  fflush(stdout);
+
+  RequestCapture(window, mLastCapturedCamera.GetHandle());
+  return true;
+}
+
+void VisualTest::RequestCapture(Dali::Window window, Dali::CameraActor customCamera)
 {
   Debug::LogMessage(Debug::INFO, "Starting draw and check()\n");
+  ProbeFrames(window);
 
   mCaptureRequestedWindow = window;
   mCaptureRequestedCamera = customCamera;
+  mCaptureStage           = 1;
+  mCaptureRequestTime     = TraceClock::now();
+  mCaptureStageTime       = mCaptureRequestTime;
 
   Dali::Animation firstFrameAnimator = Dali::Animation::New(0);
   firstFrameAnimator.FinishedSignal().Connect(this, &VisualTest::OnAnimationFinished1);
@@ -165,6 +833,8 @@ void VisualTest::CaptureWindowAfterFrameRendered(Dali::Window window, Dali::Came
 void VisualTest::OnAnimationFinished1(Dali::Animation /* not used */)
 {
   Debug::LogMessage(Debug::INFO, "First Update done()\n");
+  mCaptureStage = 2;
+  TraceCaptureStage("frame-1");
   Dali::Animation secondFrameAnimator = Dali::Animation::New(0);
   secondFrameAnimator.FinishedSignal().Connect(this, &VisualTest::OnAnimationFinished2);
   secondFrameAnimator.Play();
@@ -175,6 +845,8 @@ void VisualTest::OnAnimationFinished2(Dali::Animation /* not used */)
 {
   Debug::LogMessage(Debug::INFO, "Second Update done(). We can assume that at least 1 frame rendered now.\n");
   Debug::LogMessage(Debug::INFO, "But GPU might not be rendered to buffer well. Render 2 more frames.\n");
+  mCaptureStage = 3;
+  TraceCaptureStage("frame-2");
   Dali::Animation thirdFrameAnimator = Dali::Animation::New(0);
   thirdFrameAnimator.FinishedSignal().Connect(this, &VisualTest::OnAnimationFinished3);
   thirdFrameAnimator.Play();
@@ -184,6 +856,8 @@ void VisualTest::OnAnimationFinished2(Dali::Animation /* not used */)
 void VisualTest::OnAnimationFinished3(Dali::Animation /* not used */)
 {
   Debug::LogMessage(Debug::INFO, "Third Update done()\n");
+  mCaptureStage = 4;
+  TraceCaptureStage("frame-3");
   Dali::Animation fourthFrameAnimator = Dali::Animation::New(0);
   fourthFrameAnimator.FinishedSignal().Connect(this, &VisualTest::OnAnimationFinished4);
   fourthFrameAnimator.Play();
@@ -196,14 +870,23 @@ void VisualTest::OnAnimationFinished4(Dali::Animation /* not used */)
 
   auto window = mCaptureRequestedWindow;
   auto customCamera = mCaptureRequestedCamera;
+  mCaptureStage = 5;
+  TraceCaptureStage("frame-4");
+  mCaptureFrameMs = std::chrono::duration<double, std::milli>(mCaptureStageTime - mCaptureRequestTime).count() / 4.0;
+  TraceSpan("CaptureWindowAfterFrameRendered", mCaptureRequestTime, mCaptureStageTime, mStepIndex);
   mCaptureRequestedWindow.Reset();
   mCaptureRequestedCamera.Reset();
 
+  // Keep them, without keeping them alive, so that the same step can be captured again if the comparison fails
+  mLastCapturedWindow = window;
+  mLastCapturedCamera = customCamera;
+
   CaptureWindow(window, customCamera);
 }
 
 void VisualTest::CaptureWindow(Dali::Window window, Dali::CameraActor customCamera)
 {
+  mStepImplicit = false;
   if(gFB)
   {
     RenderTask renderTask = window.GetRenderTaskList().GetTask(0);
@@ -218,6 +901,7 @@ void VisualTest::CaptureWindow(Dali::Window window, Dali::CameraActor customCame
 void VisualTest::OnOffscreenRenderFinished(RenderTask task)
 {
   Debug::LogMessage(Debug::INFO, "VisualTest::OnOffscreenRenderFinished(), capturing offscreen\n");
+  TraceCaptureStage("OnOffscreenRenderFinished");
 
   // Ensure there's a directory to write to:
   if(!fs::exists(fs::path(gTempDir)))
@@ -230,6 +914,7 @@ void VisualTest::OnOffscreenRenderFinished(RenderTask task)
   bool success=false;
   if(n > 0)
   {
+    TraceScope trace("encode", mStepIndex);
     gImageNumber++;
 
     if(gFB)
@@ -258,17 +943,51 @@ void VisualTest::OnOffscreenRenderFinished(RenderTask task)
     task.ClearRenderResult();
     task.FinishedSignal().Disconnect(this, &VisualTest::OnOffscreenRenderFinished);
   }
-  PostRender(imageName, success);
+  mCaptureStage = 0;
+
+  const int step  = mStepIndex;
+  mRetryRequested = false;
+  {
+    TraceScope trace("PostRender", step);
+    PostRender(imageName, success);
+  }
   free(imageName);
+
+  if(gFailFast && !mRetryRequested && mResults.HasFailure())
+  {
+    printf("FAIL-FAST: %s step %d (%s) failed, stopping the test\n", gTestName, step, mStepName.c_str());
+    fflush(stdout);
+    if(mTestApplication)
+    {
+      mTestApplication.Quit();
+      return;
+    }
+  }
+
+  // Unless the test has already started its next step or captures this one again, the next step begins now
+  if(!mRetryRequested && step == mStepIndex)
+  {
+    BeginStep(std::string());
+    mStepImplicit = true;
+  }
 }
 
 bool VisualTest::CompareImageFile(const std::string fileName1, const std::string fileName2, const float similarityThreshold, const Rect<uint16_t>& areaToCompare)
 {
+  TraceScope trace("CompareImageFile", mStepIndex);
+  const auto startCounters = mPerfCounters.IsOpen() ? mPerfCounters.Read() : PerfCounterValues();
   cv::Scalar similarity;
 
+  mLastExpectedImage = fileName1;
+
   // Load the images
-  cv::Mat matrixImg1 = cv::imread(fileName1);
-  cv::Mat matrixImg2 = cv::imread(fileName2);
+  cv::Mat matrixImg1, matrixImg2;
+  {
+    TraceScope traceRead("imread", mStepIndex);
+    matrixImg1 = cv::imread(fileName1);
+    matrixImg2 = cv::imread(fileName2);
+  }
+  TraceScope traceSimilarity("SSIM", mStepIndex);
 
   if(areaToCompare != Rect<uint16_t>(0u, 0u, 0u, 0u))
   {
@@ -301,12 +1020,55 @@ bool VisualTest::CompareImageFile(const std::string fileName1, const std::string
     100.0f * similarityThreshold,
     passed ? "TRUE" : "FALSE");
 
-  gExitValue = 33.3f * (similarity.val[0] + similarity.val[1] + similarity.val[2]);
-  if(passed) gExitValue = 0;
+  StepResult result;
+  result.stepIndex     = mStepIndex;
+  result.stepName      = mStepName;
+  result.golden        = fileName1;
+  result.output        = fileName2;
+  result.similarity[0] = similarity.val[0];
+  result.similarity[1] = similarity.val[1];
+  result.similarity[2] = similarity.val[2];
+  result.threshold     = similarityThreshold;
+  result.passed        = passed;
+  result.durationMs    = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mStepStartTime).count();
+  result.frameMs       = mCaptureFrameMs;
+  result.attempt       = mRetryCount;
+  result.retried       = false;
+  mResults.Add(result);
+
+  // Every comparison counts, not only the last one
+  gExitValue = mResults.GetExitValue(gExitValue);
+
+  if(mPerfCounters.IsOpen())
+  {
+    mCompareCounters += mPerfCounters.Read() - startCounters;
+  }
 
   return passed;
 }
 
+void VisualTest::TraceCaptureStage(const char* name)
+{
+  const auto now = TraceClock::now();
+  TraceSpan(name, mCaptureStageTime, now, mStepIndex);
+  mCaptureStageTime = now;
+}
+
+void VisualTest::ReportMetric(const std::string& name, double value, const std::string& unit)
+{
+  mResults.AddMetric(name, value, unit);
+  mStepImplicit = false;
+  printf("METRIC: %s %s %.3f %s\n", gTestName, name.c_str(), value, unit.c_str());
+  fflush(stdout);
+}
+
+void VisualTest::ReportFrameSummary(const std::string& name, const FrameTimeSummary& summary)
+{
+  ReportMetric(name + ".p50", summary.p50Ms, "ms");
+  ReportMetric(name + ".p90", summary.p90Ms, "ms");
+  ReportMetric(name + ".p99", summary.p99Ms, "ms");
+}
+
 void VisualTest::EmitTouch( TouchPoint& touchPoint )
 {
   touchPoint.state =Dali::PointState::DOWN;
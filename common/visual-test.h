@@ -2,7 +2,7 @@
 #define VISUAL_TEST_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,25 +19,57 @@
  */
 
 // EXTERNAL INCLUDES
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <dali/dali.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/events/point.h>
 #include <dali/integration-api/events/touch-event-integ.h>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "frame-probe.h"
+#include "memory-sampler.h"
+#include "perf-baseline.h"
+#include "perf-counters.h"
+#include "repeat-runner.h"
+#include "startup-timeline.h"
+#include "test-metadata.h"
+#include "test-paths.h"
+#include "step-sequencer.h"
+#include "test-results.h"
+#include "trace.h"
+#include "virtual-clock.h"
+#include "watchdog.h"
 
 extern char *gTempFilename;
 extern char *gTempDir;
 extern bool gFB;
 extern int gExitValue;
+extern int gMaxRetries;
+extern uint32_t gStepTimeout;
+extern int gInstanceCount;
+extern const char *gTestName;
 
-bool ParseEnvironment(int argc, char **argv, int width, int height);
+bool ParseEnvironment(int argc, char **argv,
+                      const VisualTestMetadata &metadata);
 
 /**
- * DALI_VISUAL_TEST_WITH_WINDOW_SIZE is a wrapper for the boilerplate code to
- * create the main function of the visual test application with the given main
- * window size.
+ * @brief Get the options the test has been run with, to run it again in a
+ * child process, without those naming the outputs of this run (--results,
+ * --trace and --heartbeat) and their values.
+ */
+const std::vector<std::string> &GetChildRunArguments();
+
+/**
+ * DALI_VISUAL_TEST_MAIN is the boilerplate code of the main function of the
+ * visual test application with the given main window size. It is used by the
+ * DALI_VISUAL_TEST* macros, after the metadata record of the test.
  * @param[in] VisualTestName The class name of the visual test
  * @param[in] InitFunction The name of the callback function to connect with the
  * application's InitSignal
@@ -46,15 +78,16 @@ bool ParseEnvironment(int argc, char **argv, int width, int height);
  * @note This sets the DPI to be 96 for all tests so that text tests all produce
  * the same output image
  */
-#define DALI_VISUAL_TEST_WITH_WINDOW_SIZE(VisualTestName, InitFunction,        \
-                                          WindowWidth, WindowHeight)           \
+#define DALI_VISUAL_TEST_MAIN(VisualTestName, InitFunction, WindowWidth,       \
+                              WindowHeight)                                    \
   int DALI_EXPORT_API main(int argc, char **argv) {                            \
     int n = asprintf(&gTempDir, "/tmp/dali-tests");                            \
     if (n > 0) {                                                               \
-      bool cont = ParseEnvironment(argc, argv, WindowWidth, WindowHeight);     \
+      bool cont = ParseEnvironment(argc, argv, gTestMetadata);                 \
       if (!cont)                                                               \
         return 0;                                                              \
       n = asprintf(&gTempFilename, "%s/%s", gTempDir, #VisualTestName);        \
+      gTestName = #VisualTestName;                                             \
       setenv("DALI_DPI_HORIZONTAL", "96", true);                               \
       setenv("DALI_DPI_VERTICAL", "96", true);                                 \
       Rect<int> windowSize{0, 0, WindowWidth, WindowHeight};                   \
@@ -64,12 +97,49 @@ bool ParseEnvironment(int argc, char **argv, int width, int height);
       Application application =                                                \
           Application::New(&argc, &argv, "", false, windowData);               \
       VisualTestName test(application);                                        \
+      VisualTest *base = &test;                                                \
+      test.SetApplication(application);                                        \
+      application.InitSignal().Connect(base, &VisualTest::OnInitStarted);      \
       application.InitSignal().Connect(&test, &VisualTestName::InitFunction);  \
+      application.InitSignal().Connect(base, &VisualTest::OnInitFinished);     \
       application.MainLoop();                                                  \
       return gExitValue;                                                       \
     }                                                                          \
   }
 
+/**
+ * DALI_VISUAL_TEST_WITH_STEPS is a wrapper for the boilerplate code to create
+ * the main function of the visual test application with the given main window
+ * size, and to record the steps of the test in its metadata.
+ * @param[in] VisualTestName The class name of the visual test
+ * @param[in] InitFunction The name of the callback function to connect with the
+ * application's InitSignal
+ * @param[in] WindowWidth The width of the application's main window
+ * @param[in] WindowHeight The height of the application's main window
+ * @param[in] StepCount The number of steps of the test, or 0 if not known
+ * @param[in] StepTimeout The default deadline of a step in milliseconds
+ */
+#define DALI_VISUAL_TEST_WITH_STEPS(VisualTestName, InitFunction, WindowWidth, \
+                                    WindowHeight, StepCount, StepTimeout)      \
+  DALI_VISUAL_TEST_METADATA(VisualTestName, WindowWidth, WindowHeight,         \
+                            StepCount, StepTimeout, 0u)                        \
+  DALI_VISUAL_TEST_MAIN(VisualTestName, InitFunction, WindowWidth, WindowHeight)
+
+/**
+ * DALI_VISUAL_TEST_WITH_WINDOW_SIZE is a wrapper for the boilerplate code to
+ * create the main function of the visual test application with the given main
+ * window size.
+ * @param[in] VisualTestName The class name of the visual test
+ * @param[in] InitFunction The name of the callback function to connect with the
+ * application's InitSignal
+ * @param[in] WindowWidth The width of the application's main window
+ * @param[in] WindowHeight The height of the application's main window
+ */
+#define DALI_VISUAL_TEST_WITH_WINDOW_SIZE(VisualTestName, InitFunction,        \
+                                          WindowWidth, WindowHeight)           \
+  DALI_VISUAL_TEST_WITH_STEPS(VisualTestName, InitFunction, WindowWidth,       \
+                              WindowHeight, 0, DEFAULT_STEP_TIMEOUT)
+
 /**
  * DALI_VISUAL_TEST is a wrapper for the boilerplate code to create the main
  * function of the visual test application with the default main window size
@@ -84,6 +154,9 @@ bool ParseEnvironment(int argc, char **argv, int width, int height);
 // The default threshold for image similarity
 #define DEFAULT_IMAGE_SIMILARITY_THRESHOLD 0.99f
 
+// The default deadline of a test step in milliseconds (see --step-timeout)
+#define DEFAULT_STEP_TIMEOUT 60000u
+
 /**
  * @brief This class provides the functionality of visual test by capturing the
  * content rendered by the GPU in the given window and compare it with a given
@@ -96,11 +169,32 @@ public:
    */
   VisualTest();
 
+  /**
+   * @brief Set the application of the test, which is quit by --fail-fast.
+   * @note This is called by the DALI_VISUAL_TEST* macros.
+   * @param[in] application The application of the test
+   */
+  void SetApplication(Dali::Application application);
+
+  /**
+   * @brief Called before and after the InitFunction of the test to trace it,
+   * and to start recording the frame times of the main window.
+   * @note These are connected by the DALI_VISUAL_TEST* macros.
+   */
+  void OnInitStarted(Dali::Application &application);
+  void OnInitFinished(Dali::Application &application);
+
+  /**
+   * @brief Called when the application terminates, to end the last step and
+   * check the performance baseline while the exit value can still change.
+   */
+  void OnTerminate(Dali::Application &application);
+
 protected:
   /**
-   * @brief Default Destructor.
+   * @brief Destructor.
    */
-  virtual ~VisualTest() = default;
+  virtual ~VisualTest();
 
   /**
    * @brief Capture the content of the given window rendered by GPU
@@ -126,6 +220,12 @@ protected:
 
   /**
    * @brief Compare the given area in the two image files.
+   *
+   * The result is added to the results table of the test, which is written as
+   * JSON when the test exits (see --results). With --fail-fast, the
+   * application quits once PostRender returns after a failed comparison which
+   * is not retried.
+   *
    * @param[in] fileName1 The first image file
    * @param[in] fileName2 The second image file
    * @param[in] similarityThreshold The threshold for similarity comparison
@@ -139,6 +239,90 @@ protected:
                         const Dali::Rect<uint16_t> &areaToCompare =
                             Dali::Rect<uint16_t>(0u, 0u, 0u, 0u));
 
+  /**
+   * @brief Re-capture the window of the last capture after a failed
+   * comparison.
+   *
+   * The capture goes through a new CaptureWindowAfterFrameRendered cycle, so
+   * PostRender will be called again for the same step. Retries are limited by
+   * the --retries command line option and are counted per step, i.e. the count
+   * is reset whenever the test requests a new capture itself.
+   *
+   * @code
+   * if (!CompareImageFile(expectedFile, outputFile, 0.98f) && RetryCapture()) {
+   *   return; // PostRender will be called again with the new capture
+   * }
+   * @endcode
+   *
+   * @return True if a re-capture has been scheduled, false if there are no
+   * retries left for this step
+   */
+  bool RetryCapture();
+
+  /**
+   * @brief Start a new step of the test.
+   *
+   * The watchdog checks that every step finishes within its deadline. If it
+   * does not, the state of the test is dumped and the test exits with
+   * WATCHDOG_EXIT_VALUE. A step which is not started explicitly begins when the
+   * capture of the previous step has been handled by PostRender, and is left
+   * out of the results if the test ends without capturing, reporting a metric
+   * or failing in it.
+   *
+   * @param[in] name The name of the step, reported in the heartbeat lines
+   * @param[in] timeout The deadline of the step in milliseconds, or 0 to use
+   * the one given with --step-timeout
+   */
+  void BeginStep(const std::string &name, uint32_t timeout = 0u);
+
+  /**
+   * @brief Set the number of resources the current step waits for. It is
+   * reported together with the number of ready resources if the step expires.
+   * @param[in] count The number of resources expected to be ready
+   */
+  void SetExpectedResourceCount(int count);
+
+  /**
+   * @brief Count one more resource ready in the current step.
+   */
+  void IncrementResourceReadyCount();
+
+  /**
+   * @brief Fail the current step without a comparison, e.g. because it has
+   * given up waiting. The failure is added to the results table, and the test
+   * exits with a failure.
+   * @param[in] reason Why the step has failed
+   */
+  void FailStep(const std::string &reason);
+
+  /**
+   * @brief Check whether a step has failed, by FailStep or by a comparison
+   * which is not retried.
+   */
+  bool HasFailure() const;
+
+  /**
+   * @brief Report a measure of the test, e.g. of a benchmark.
+   *
+   * The measure is added to the "metrics" of the results JSON and printed as
+   * a METRIC: line, which the runner reports.
+   *
+   * @param[in] name The name of the measure, e.g. "cold.first-frame"
+   * @param[in] value The value of the measure
+   * @param[in] unit The unit of the value, e.g. "ms"
+   */
+  void ReportMetric(const std::string &name, double value,
+                    const std::string &unit);
+
+  /**
+   * @brief Report the percentiles of frame times, e.g. of a FrameCostProbe,
+   * as the measures name.p50, name.p90 and name.p99 in ms.
+   * @param[in] name The prefix of the measures, e.g. "1800x1200.interval"
+   * @param[in] summary The frame times
+   */
+  void ReportFrameSummary(const std::string &name,
+                          const FrameTimeSummary &summary);
+
   /**
    * @brief Emits a single touch
    *
@@ -151,6 +335,8 @@ protected:
   void EmitTouch(Dali::TouchPoint &touchPoint);
 
 private:
+  friend class StepSequencer; // Captures the window and begins the steps
+
   /**
    * @brief This virtual function will be called after the offscreen window
    * frame buffer has been rendered.
@@ -191,6 +377,86 @@ private:
   void OnAnimationFinished3(Dali::Animation /* not used */);
   void OnAnimationFinished4(Dali::Animation /* not used */);
 
+  /**
+   * @brief Start the frame rendered cycle which captures the given window
+   * @param[in] window The window to be captured
+   * @param[in] customCamera The custom camera to be used to render the
+   * offscreen frame buffer
+   */
+  void RequestCapture(Dali::Window window, Dali::CameraActor customCamera);
+
+  /**
+   * @brief Trace the capture stage which has just ended.
+   * @param[in] name The name of the stage, which must be a string literal
+   */
+  void TraceCaptureStage(const char *name);
+
+  /**
+   * @brief Write the state of the test when the current step has expired.
+   * @note This is called from the watchdog thread.
+   * @param[in] output The file to write the state to
+   */
+  void DumpState(FILE *output);
+
+  /**
+   * @brief Write the results table as JSON to the file given with --results,
+   * or next to the captured images by default.
+   * @param[in] complete Whether the test has run to its end
+   */
+  void WriteResults(bool complete);
+
+  /**
+   * @brief Record the span of the current step and write the trace to the
+   * file given with --trace, if any.
+   */
+  void WriteTraceFile();
+
+  /**
+   * @brief Record the duration of the current step, which has just ended.
+   */
+  void EndStepTiming();
+
+  /**
+   * @brief Record the memory of the current step, which has just ended, and
+   * report it if it retains more than the budget given with --memory-budget.
+   */
+  void EndStepMemory();
+
+  /**
+   * @brief Record the hardware counters of the current step, which has just
+   * ended, if --perf-counters is given.
+   */
+  void EndStepCounters();
+
+  /**
+   * @brief Start recording the frame times of the given window, unless they
+   * are already recorded.
+   */
+  void ProbeFrames(Dali::Window window);
+
+  /**
+   * @brief Stop recording the frame times of the windows and add them to the
+   * results.
+   */
+  void EndFrameProbes();
+
+  /**
+   * @brief Release the shared shaders, add the programs and the growth of the
+   * shader cache to the results and save its index.
+   */
+  void EndShaderCache();
+
+  /**
+   * @brief End the last step of the test and check its performance baseline.
+   * It does nothing if it has already been called.
+   */
+  void FinishTest();
+
+  /**
+   * @brief Compare the run with the performance baseline of the test, if any.
+   */
+  void CheckPerfBaseline();
+
 private:
   Dali::Texture mTexture;         ///< The texture for the offscreen rendering
   Dali::FrameBuffer mFrameBuffer; ///< The frame buffer for offscreen rendering
@@ -203,6 +469,41 @@ private:
 
   Dali::Window mCaptureRequestedWindow;
   Dali::CameraActor mCaptureRequestedCamera;
+
+  Dali::WeakHandle<Dali::Window>
+      mLastCapturedWindow; ///< The window of the last capture, not kept alive
+  Dali::WeakHandle<Dali::CameraActor>
+      mLastCapturedCamera; ///< The camera of the last capture
+  std::string mLastExpectedImage; ///< The image of the last comparison
+  std::atomic<int> mRetryCount;   ///< The number of retries of current step
+  bool mRetryRequested; ///< Whether RetryCapture has been called in PostRender
+
+  Watchdog mWatchdog;    ///< Checks the deadline of each step
+  std::mutex mStepMutex; ///< Guards the step, which DumpState reads
+  int mStepIndex;        ///< The index of the current step, starting from 1
+  std::string mStepName; ///< The name of the current step
+  bool mStepImplicit; ///< Whether the step has begun after a capture by itself,
+                      ///< and the test has done nothing in it yet
+  std::atomic<bool> mStepDropped; ///< Whether FinishTest has dropped the last,
+                                  ///< empty step
+  std::atomic<int> mCaptureStage; ///< 0: idle, 1-4: waiting for the Nth frame,
+                                  ///< 5: waiting for the offscreen render task
+  std::atomic<int> mExpectedResourceCount;
+  std::atomic<int> mResourceReadyCount;
+
+  Dali::Application mTestApplication; ///< The application quit by --fail-fast
+  std::chrono::steady_clock::time_point mStepStartTime;
+  MemorySample mStepStartMemory;        ///< The memory when the step began
+  PerfCounters mPerfCounters;           ///< Opened with --perf-counters
+  PerfCounterValues mStepStartCounters; ///< The counters when the step began
+  PerfCounterValues mCompareCounters;   ///< The counters of the comparisons
+  TraceClock::time_point mInitStartTime;      ///< When OnInit started
+  TraceClock::time_point mCaptureRequestTime; ///< When the capture started
+  TraceClock::time_point mCaptureStageTime;   ///< When the capture stage began
+  double mCaptureFrameMs; ///< The mean frame time of the last capture wait
+  std::vector<std::unique_ptr<FrameProbe>> mFrameProbes; ///< One per window
+  bool mFinished;         ///< Whether FinishTest has been called
+  TestResults mResults; ///< The comparisons done by the test
 };
 
 #endif // VISUAL_TEST_H
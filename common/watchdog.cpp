@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "watchdog.h"
+
+// EXTERNAL INCLUDES
+#include <unistd.h>
+
+namespace
+{
+long long ElapsedMilliseconds(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(to - from).count();
+}
+} // namespace
+
+Watchdog::Watchdog()
+: mRunning(false),
+  mHeartbeat(nullptr),
+  mStepIndex(0),
+  mStepTimeout(0u)
+{
+}
+
+Watchdog::~Watchdog()
+{
+  Stop();
+}
+
+void Watchdog::Start(const std::string& testName, const std::string& heartbeatFile, StateDumper dumper)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  if(mRunning)
+  {
+    return;
+  }
+
+  mTestName = testName;
+  mDumper   = dumper;
+
+  if(heartbeatFile == "-")
+  {
+    mHeartbeat = stderr;
+  }
+  else if(!heartbeatFile.empty())
+  {
+    mHeartbeat = fopen(heartbeatFile.c_str(), "w");
+    if(!mHeartbeat)
+    {
+      fprintf(stderr, "Unable to open the heartbeat file %s\n", heartbeatFile.c_str());
+    }
+  }
+
+  mStartTime = mStepTime = Clock::now();
+  mRunning               = true;
+  mThread                = std::thread(&Watchdog::Run, this);
+}
+
+void Watchdog::Arm(int stepIndex, const std::string& stepName, uint32_t timeout)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mStepIndex   = stepIndex;
+  mStepName    = stepName;
+  mStepTimeout = timeout;
+  mStepTime    = Clock::now();
+}
+
+void Watchdog::Stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mRunning = false;
+  }
+  mCondition.notify_all();
+
+  if(mThread.joinable())
+  {
+    mThread.join();
+  }
+
+  if(mHeartbeat && mHeartbeat != stderr)
+  {
+    fclose(mHeartbeat);
+  }
+  mHeartbeat = nullptr;
+}
+
+void Watchdog::Run()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  while(mRunning)
+  {
+    // Wake up at the next heartbeat or at the deadline of the step, whichever comes first
+    auto wakeUp   = Clock::now() + std::chrono::milliseconds(WATCHDOG_HEARTBEAT_INTERVAL);
+    auto deadline = mStepTime + std::chrono::milliseconds(mStepTimeout);
+    if(mStepTimeout > 0u && deadline < wakeUp)
+    {
+      wakeUp = deadline;
+    }
+    mCondition.wait_until(lock, wakeUp);
+    if(!mRunning)
+    {
+      break;
+    }
+
+    auto now = Clock::now();
+    if(mStepTimeout > 0u && now >= mStepTime + std::chrono::milliseconds(mStepTimeout))
+    {
+      Expire(now);
+    }
+
+    if(mHeartbeat)
+    {
+      fprintf(mHeartbeat, "HEARTBEAT test=%s step=%d name=%s step_ms=%lld total_ms=%lld\n", mTestName.c_str(), mStepIndex, mStepName.c_str(), ElapsedMilliseconds(mStepTime, now), ElapsedMilliseconds(mStartTime, now));
+      fflush(mHeartbeat);
+    }
+  }
+}
+
+void Watchdog::Expire(Clock::time_point now)
+{
+  fflush(stdout);
+  fprintf(stderr,
+          "WATCHDOG: %s step %d (%s) did not finish within %u ms\n"
+          "  Time spent in the step: %lld ms\n"
+          "  Time spent in the test: %lld ms\n",
+          mTestName.c_str(),
+          mStepIndex,
+          mStepName.c_str(),
+          mStepTimeout,
+          ElapsedMilliseconds(mStepTime, now),
+          ElapsedMilliseconds(mStartTime, now));
+  if(mDumper)
+  {
+    mDumper(stderr);
+  }
+  fflush(stderr);
+
+  if(mHeartbeat)
+  {
+    fprintf(mHeartbeat, "TIMEOUT test=%s step=%d name=%s step_ms=%lld total_ms=%lld\n", mTestName.c_str(), mStepIndex, mStepName.c_str(), ElapsedMilliseconds(mStepTime, now), ElapsedMilliseconds(mStartTime, now));
+    fflush(mHeartbeat);
+  }
+
+  // The event thread may be blocked, so do not wait for anything to be cleaned up
+  _exit(WATCHDOG_EXIT_VALUE);
+}
@@ -0,0 +1,118 @@
+#ifndef WATCHDOG_H
+#define WATCHDOG_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// The exit value of a test which has been stopped by the watchdog
+#define WATCHDOG_EXIT_VALUE 101
+
+// The interval between two heartbeat lines in milliseconds
+#define WATCHDOG_HEARTBEAT_INTERVAL 1000u
+
+/**
+ * @brief Watches the steps of a visual test from its own thread.
+ *
+ * Every step is armed with a deadline. While a step is running, a heartbeat
+ * line with the current step and the elapsed time is written periodically so
+ * that the runner can follow the progress of the test. If a step does not
+ * finish before its deadline, the state of the test is dumped and the process
+ * exits with WATCHDOG_EXIT_VALUE, even when the event thread is blocked.
+ */
+class Watchdog {
+public:
+  /**
+   * @brief The function which writes the state of the test when a step has
+   * expired. It is called from the watchdog thread.
+   */
+  using StateDumper = std::function<void(FILE *)>;
+
+  /**
+   * @brief Constructor.
+   */
+  Watchdog();
+
+  /**
+   * @brief Destructor. Stops the watchdog thread.
+   */
+  ~Watchdog();
+
+  /**
+   * @brief Start the watchdog thread.
+   * @param[in] testName The name of the test, used in the heartbeat lines
+   * @param[in] heartbeatFile The file to write the heartbeat lines to, "-" for
+   * stderr, or empty if no heartbeat is required
+   * @param[in] dumper The function which writes the state of the test on expiry
+   */
+  void Start(const std::string &testName, const std::string &heartbeatFile,
+             StateDumper dumper);
+
+  /**
+   * @brief Arm the watchdog for a new step.
+   * @param[in] stepIndex The index of the step
+   * @param[in] stepName The name of the step
+   * @param[in] timeout The deadline of the step in milliseconds
+   */
+  void Arm(int stepIndex, const std::string &stepName, uint32_t timeout);
+
+  /**
+   * @brief Stop the watchdog thread. No deadline is checked afterwards.
+   */
+  void Stop();
+
+private:
+  /**
+   * @brief The main function of the watchdog thread.
+   */
+  void Run();
+
+  /**
+   * @brief Write the state of the test and terminate the process.
+   * @param[in] now The time at which the deadline has been found expired
+   */
+  [[noreturn]] void Expire(std::chrono::steady_clock::time_point now);
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  std::thread mThread;
+  std::mutex mMutex;
+  std::condition_variable mCondition;
+  bool mRunning;
+
+  std::string mTestName;
+  FILE *mHeartbeat; ///< The heartbeat output, or nullptr
+  StateDumper mDumper;
+
+  Clock::time_point mStartTime; ///< The time at which the watchdog started
+  Clock::time_point mStepTime;  ///< The time at which the current step started
+  int mStepIndex;
+  std::string mStepName;
+  uint32_t mStepTimeout; ///< The deadline of the current step in milliseconds
+};
+
+#endif // WATCHDOG_H
@@ -10,14 +10,141 @@ Usage()
     exit 0
 }
 
+# Read the metadata record of a test executable without running it, see common/test-metadata.h
+# Sets metaWidth, metaHeight, metaSteps, metaStepTimeout, metaFlags, metaImageDir, metaSceneDir and metaResourcesDir,
+# returns non-zero if there is no record
+ReadTestMetadata()
+{
+    local binary=$(command -v $1)
+    local section=$(mktemp)
+    metaWidth=
+    metaHeight=
+    metaSteps=
+    metaStepTimeout=
+    metaFlags=0
+    metaImageDir=
+    metaSceneDir=
+    metaResourcesDir=
+    if [ -n "$binary" ] && objcopy -O binary --only-section=.dali_test_meta $binary $section 2>/dev/null \
+       && [ "$(head -c 7 $section)" = "DALITST" ]; then
+        read metaVersion metaWidth metaHeight metaSteps metaStepTimeout <<< $(od -An -w20 -t u4 -j 8 -N 20 $section)
+        # The version 1 records have no flags, the strings start right after the step deadline
+        local strings=92
+        if [ "$metaVersion" -ge 2 ]; then
+            metaFlags=$(od -An -t u4 -j 28 -N 4 $section | tr -d ' ')
+            strings=96
+        fi
+        metaImageDir=$(dd if=$section bs=1 skip=$strings count=256 2>/dev/null | tr -d '\0')
+        metaSceneDir=$(dd if=$section bs=1 skip=$(( strings + 256 )) count=256 2>/dev/null | tr -d '\0')
+        metaResourcesDir=$(dd if=$section bs=1 skip=$(( strings + 512 )) count=256 2>/dev/null | tr -d '\0')
+    fi
+    rm -f $section
+    [ -n "$metaWidth" ]
+}
+
+# Stage the test data in the background while the first tests run, see --stage
+# tmpfs:   copy the data to /dev/shm, the tests use the copy once it is complete
+# prewarm: read the data once so that it is in the page cache
+StartStaging()
+{
+    local mode=$1
+    local dataSize=$(du -sk $metaImageDir $metaSceneDir $metaResourcesDir 2>/dev/null | awk '{ total += $1 } END { print total }')
+
+    if [ "$mode" = "tmpfs" ]; then
+        local available=$(df -k --output=avail /dev/shm 2>/dev/null | tail -n 1)
+        if [ -z "$available" ] || [ "$available" -le "$dataSize" ]; then
+            echo "Not enough space in /dev/shm for ${dataSize}kB of test data, prewarming the page cache instead"
+            mode=prewarm
+        fi
+    fi
+
+    if [ "$mode" = "tmpfs" ]; then
+        stageDir=$(mktemp -d /dev/shm/dali-test-data.XXXXXX)
+        (
+            for pair in "$metaImageDir images" "$metaSceneDir scenes" "$metaResourcesDir resources"; do
+                set -- $pair
+                if [ -d "$1" ]; then
+                    cp -a $1 $stageDir/$2 || exit 1
+                fi
+            done
+            touch $stageDir/.complete
+        ) &
+        stagePid=$!
+    elif [ "$mode" = "prewarm" ]; then
+        find $metaImageDir $metaSceneDir $metaResourcesDir -type f -print0 2>/dev/null | xargs -0 -r -P 4 -n 16 cat > /dev/null &
+        stagePid=$!
+    else
+        echo "Unknown staging mode $mode"
+        return 1
+    fi
+    echo "Staging ${dataSize}kB of test data ($mode) in the background"
+}
+
+# Point the tests at the staged copy of the test data once it is complete
+UseStagedData()
+{
+    if [ -n "$stageDir" ] && [ -z "$stageUsed" ] && [ -e $stageDir/.complete ]; then
+        export TEST_IMAGE_DIR=$stageDir/images/
+        export TEST_SCENE_DIR=$stageDir/scenes/
+        export TEST_RESOURCES_DIR=$stageDir/resources/
+        stageUsed=1
+        echo "Using the test data staged in $stageDir"
+    fi
+}
+
+StopStaging()
+{
+    if [ -n "$stagePid" ]; then
+        kill $stagePid 2>/dev/null
+        wait $stagePid 2>/dev/null
+    fi
+    if [ -n "$stageDir" ]; then
+        rm -rf $stageDir
+    fi
+    stagePid=
+    stageDir=
+}
+
+# Remove the logs and the staged test data however the run ends, e.g. on Ctrl-C
+CleanUp()
+{
+    rm -rf $logDir
+    StopStaging
+}
+
 # Initialise the options
-OPTS=$(getopt -o vhxt:d: --long directory:,verbose,help,xml,test: -n "$(basename "$0")" -- "$@")
+OPTS=$(getopt -o vhxfcplnBt:d:r:s:T:m:b:g:k:u:a:e:R:i: --long directory:,results-dir:,verbose,help,xml,fail-fast,benchmarks,virtual-clock,perf-counters,surfaceless,no-shader-cache,test:,retries:,stage:,trace:,memory-budget:,rebaseline-perf:,perf-gate:,repeat:,cpus:,compare-with:,shader-cache:,instances: -n "$(basename "$0")" -- "$@")
 if [ $? != 0 ]; then echo; Usage; fi
 eval set -- "$OPTS"
 
-REDIRECT_OUTPUT="> /dev/null 2>&1"
+VERBOSE=
 GENERATE_XML=
 TEST_TO_EXECUTE=
+RETRIES=1
+FAIL_FAST=
+VIRTUAL_CLOCK=
+STAGE=
+TRACE_FILE=
+MEMORY_BUDGET=
+PERF_COUNTERS=
+PERF_GATE=
+REBASELINE_RUNS=
+SURFACELESS=
+REPEAT=
+CPUS=
+COMPARE_WITH=
+SHADER_CACHE=
+INSTANCES=
+BENCHMARKS=
+RESULTS_DIR=
+OUTPUT_DIR=
+# The exit value of a test slower than its performance baseline, see common/perf-baseline.h
+PERF_REGRESSION_EXIT_VALUE=102
+stageDir=
+stagePid=
+stageUsed=
+# The exit value of a test stopped by its watchdog, see common/watchdog.h
+WATCHDOG_EXIT_VALUE=101
 export DALI_DISABLE_PARTIAL_UPDATE=1
 
 dir=""
@@ -29,12 +156,85 @@ if [[ $* > 1 ]] ; then
         case "$1" in
             -d|--directory ) # Outputs captured images to this directory
                 dir="--directory $2"
+                OUTPUT_DIR="$2"
+                shift 2
+                ;;
+            -R|--results-dir ) # Write the results JSON of each test to this directory (default: --directory, or ./visual-tests-results)
+                RESULTS_DIR="$2"
                 shift 2
                 ;;
             -v|--verbose ) # Verbose output for every test case
-                REDIRECT_OUTPUT=
+                VERBOSE=1
+                shift
+                ;;
+            -r|--retries ) # Number of times a failed capture is retried (default 1)
+                RETRIES="$2"
+                shift 2
+                ;;
+            -s|--stage ) # Stage the test data while the tests run: tmpfs or prewarm
+                STAGE="$2"
+                shift 2
+                ;;
+            -c|--virtual-clock ) # Drive the animations of the tests with a virtual clock
+                VIRTUAL_CLOCK="--virtual-clock"
+                shift
+                ;;
+            -l|--surfaceless ) # Render the tests with a surfaceless EGL display instead of Xvfb
+                SURFACELESS=1
+                shift
+                ;;
+            -e|--shader-cache ) # Keep the compiled shaders of the GL driver in this directory across the tests
+                SHADER_CACHE="--shader-cache $2"
+                shift 2
+                ;;
+            -n|--no-shader-cache ) # Compile the shaders of every test from scratch, e.g. to measure it
+                SHADER_CACHE="--no-shader-cache"
+                shift
+                ;;
+            -f|--fail-fast ) # Stop each test at its first failed comparison
+                FAIL_FAST="--fail-fast"
+                shift
+                ;;
+            -p|--perf-counters ) # Record the hardware counters of each test step in its results
+                PERF_COUNTERS="--perf-counters"
+                shift
+                ;;
+            -b|--rebaseline-perf ) # Rewrite the perf-baseline.json of the tests from the median of this many runs
+                REBASELINE_RUNS="$2"
+                shift 2
+                ;;
+            -g|--perf-gate ) # What a regression against perf-baseline.json does: off, warn or fail
+                PERF_GATE="--perf-gate $2"
+                shift 2
+                ;;
+            -m|--memory-budget ) # Report the test steps which retain more than this memory in kB
+                MEMORY_BUDGET="--memory-budget $2"
+                shift 2
+                ;;
+            -k|--repeat ) # Run each test this many times and report the statistics of its timings
+                REPEAT="$2"
+                shift 2
+                ;;
+            -u|--cpus ) # Pin the tests to these CPUs, e.g. 2,3 or 4-7
+                CPUS="--cpus $2"
+                shift 2
+                ;;
+            -a|--compare-with ) # With --repeat, compare with the tests installed in this directory of another build
+                COMPARE_WITH="$2"
+                shift 2
+                ;;
+            -B|--benchmarks ) # Run the benchmarks as well, which are skipped unless named by --test
+                BENCHMARKS=1
                 shift
                 ;;
+            -i|--instances ) # Measure this number of instances in the benchmarks of many instances, e.g. scene3d-animation
+                INSTANCES="--instances $2"
+                shift 2
+                ;;
+            -T|--trace ) # Write the harness phases of all the tests to this Chrome trace file
+                TRACE_FILE="$2"
+                shift 2
+                ;;
 
             -h|--help ) # Help
                 shift
@@ -76,32 +276,175 @@ num_fails=0
 
 testOutput=""
 
+# The output of each test is kept so that the retried captures can be reported
+logDir=$(mktemp -d /tmp/dali-test-logs.XXXXXX)
+trap CleanUp EXIT
+
+# The results of the tests outlive the logs, so that CI can collect them
+if [[ "$RESULTS_DIR" = "" ]] ; then
+    RESULTS_DIR=${OUTPUT_DIR:-visual-tests-results}
+fi
+mkdir -p $RESULTS_DIR
+set -o pipefail
+
 DEBUG=""
 #DEBUG=gdb --args
 
+# Give each test the time at which it is executed, after the X server has started, see common/startup-timeline.h
+# The time is empty with a bash older than 5.0, the test falls back to the start time kept by the kernel
+execTime="bash -c 'now=\${EPOCHREALTIME/[.,]/}; export DALI_STARTUP_EXEC_TIME=\${now:+\${now}000}; exec \"\$@\"' exec-time"
+
 if [[ "$TEST_TO_EXECUTE" != "" ]] ; then
   tests=$TEST_TO_EXECUTE
   num_tests=1
 fi
 
+# All the tests share the same data directories, so the first test tells where they are
+if [[ "$STAGE" != "" ]] ; then
+    firstTest=$(basename $(echo $tests | cut -d' ' -f1)).test
+    if ReadTestMetadata $firstTest; then
+        StartStaging $STAGE
+    else
+        echo "$firstTest has no metadata record, the test data is not staged"
+    fi
+fi
+
 # Execute each test executable in turn
 for i in $tests ; do
     test=$(basename $i).test
-    dimensions=$($test --get-dimensions 2>/dev/null)
-    command="timeout 3m xvfb-run -s \"-screen 0 $dimensions -fbdir /var/tmp\" $DEBUG $test --fb $dir ${REDIRECT_OUTPUT}"
+    UseStagedData
+    testTimeout=3m
+    if ReadTestMetadata $test; then
+        # The benchmarks (TEST_METADATA_FLAG_BENCHMARK in common/test-metadata.h) take minutes and compare no capture
+        if (( metaFlags & 1 )) && [[ "$BENCHMARKS" = "" ]] && [[ "$TEST_TO_EXECUTE" = "" ]]; then
+            echo "Skipping the benchmark $test, see --benchmarks"
+            ((num_tests--))
+            continue
+        fi
+        dimensions="${metaWidth}x${metaHeight}x24"
+        # A test which declares its steps cannot take longer than all of its step deadlines
+        if [ "$metaSteps" != "0" ]; then
+            testTimeout="$(( (metaSteps + 1) * metaStepTimeout / 1000 + 30 ))s"
+        fi
+    else
+        # Older test executables have no metadata record
+        dimensions=$($test --get-dimensions 2>/dev/null)
+    fi
+    # The runs of --repeat share the timeout of the test, twice as many of them with --compare-with
+    repeat=
+    if [[ "$REPEAT" != "" ]] ; then
+        runs=$REPEAT
+        repeat="--repeat $REPEAT"
+        if [[ "$COMPARE_WITH" != "" ]] ; then
+            runs=$(( runs * 2 ))
+            repeat="$repeat --compare-with $COMPARE_WITH/$test"
+        fi
+        testTimeout="$(( ${testTimeout%[sm]} * runs ))${testTimeout: -1}"
+    fi
+    logFile=$logDir/$test.log
+    heartbeatFile=$logDir/$test.heartbeat
+    resultsFile=$RESULTS_DIR/$test.results.json
+    trace=
+    if [[ "$TRACE_FILE" != "" ]] ; then
+        trace="--trace $logDir/$test.trace.json"
+    fi
+    if [[ "$VERBOSE" = "1" ]] ; then
+        redirect="2>&1 | tee $logFile"
+    else
+        redirect="> $logFile 2>&1"
+    fi
+    if [[ "$SURFACELESS" = "1" ]] ; then
+        # No X server, the captures are taken from the offscreen frame buffer
+        launcher=""
+        capture="--surfaceless"
+    else
+        launcher="xvfb-run -s \"-screen 0 $dimensions -fbdir /var/tmp\""
+        capture="--fb"
+    fi
+    command="timeout $testTimeout $launcher $DEBUG $execTime $test $capture --retries $RETRIES --heartbeat $heartbeatFile --results $resultsFile $trace $MEMORY_BUDGET $PERF_COUNTERS $PERF_GATE $repeat $CPUS $SHADER_CACHE $INSTANCES $FAIL_FAST $VIRTUAL_CLOCK $dir $redirect"
     echo -e "${Bold}Executing: $command"
-    # Run a second time if failed the first as it seems to fail incorrectly from time to time
-    eval $command || eval $command
+    # Captures that fail to match are retried within the test, see --retries
+    eval $command
 
     percent=$?
+    echo "Results of $test written to $resultsFile"
+
+    # The baseline is measured from further runs of the test, the first one gives its result
+    if [[ "$REBASELINE_RUNS" != "" ]] ; then
+        runResults="--baseline-run $resultsFile"
+        for run in $(seq 2 $REBASELINE_RUNS); do
+            runCommand=${command//$resultsFile/$resultsFile.$run}
+            eval ${runCommand//$logFile/$logFile.$run} > /dev/null 2>&1
+            runResults="$runResults --baseline-run $resultsFile.$run"
+        done
+        # The test computes the medians itself, see common/perf-baseline.h
+        baselineFile=$scriptLocation/visual-tests/$(basename $i)/perf-baseline.json
+        $test --write-perf-baseline $baselineFile $runResults
+        echo "Performance baseline written to $baselineFile from $REBASELINE_RUNS run(s), install it to use it"
+    fi
+
+    # Report the regressions against the performance baseline
+    if grep -q "^PERF-REGRESSION:" $logFile; then
+        echo -e "${Bold}$test is slower than its performance baseline:${Clear}"
+        grep "^PERF-REGRESSION:" $logFile | sed 's/^/    /'
+    fi
+
+    # Report the statistics of the runs of --repeat
+    if grep -q "^REPEAT:" $logFile; then
+        echo -e "${Bold}$test timings:${Clear}"
+        grep -E "^(REPEAT|STATS|COMPARE):" $logFile | sed 's/^/    /'
+    fi
+
+    # Report the measures of the benchmarks
+    if grep -q "^METRIC:" $logFile; then
+        echo -e "${Bold}$test measures:${Clear}"
+        grep "^METRIC:" $logFile | sed 's/^/    /'
+    fi
+
+    # Report the flaky steps
+    retries=$(grep -c "^RETRY:" $logFile)
+    if [ "$retries" != "0" ]; then
+        echo -e "${Bold}$test retried $retries capture(s):${Clear}"
+        grep "^RETRY:" $logFile | sed 's/^/    /'
+    fi
+
+    # Report the steps which have failed without a comparison, e.g. after waiting too long
+    if grep -q "^FAIL:" $logFile; then
+        echo -e "${Bold}$test failed step(s):${Clear}"
+        grep "^FAIL:" $logFile | sed 's/^/    /'
+    fi
+
+    # Report the steps which have not released their memory
+    if grep -q "^MEMORY:" $logFile; then
+        echo -e "${Bold}$test retained memory over the budget:${Clear}"
+        grep "^MEMORY:" $logFile | sed 's/^/    /'
+    fi
+
     # Check the test result
-    if [ "$percent" != "0" ]; then
+    if [ "$percent" = "$WATCHDOG_EXIT_VALUE" ]; then
+        # A step did not finish within its deadline, the state of the test is in the log
+        echo "$test Failed (timed out: $(grep "^TIMEOUT" $heartbeatFile))"
+        grep -A 8 "^WATCHDOG:" $logFile | sed 's/^/    /'
+        testOutput="$testOutput $test,Failed,$retries"
+        ((num_fails++))
+    elif [ "$percent" = "$PERF_REGRESSION_EXIT_VALUE" ]; then
+        echo "$test Failed (performance regression)"
+        testOutput="$testOutput $test,Failed,$retries"
+        ((num_fails++))
+    elif [ "$percent" = "124" ]; then
+        # Killed by timeout(1), the last heartbeat shows where the test was
+        echo "$test Failed (killed, last heartbeat: $(tail -n 1 $heartbeatFile 2>/dev/null))"
+        testOutput="$testOutput $test,Failed,$retries"
+        ((num_fails++))
+    elif [ "$percent" != "0" ]; then
         echo "$test Failed ($percent % match)"
-        testOutput="$testOutput $test,Failed"
+        # The results table has one line per comparison, list the ones which failed for good
+        sed -n 's/.*"name": "\([^"]*\)", "golden": "\([^"]*\)".*"passed": false.*"retried": false.*/    Failed step: \1 (\2)/p' $resultsFile 2>/dev/null
+        testOutput="$testOutput $test,Failed,$retries"
         ((num_fails++))
     else
         echo "$test Passed"
-        testOutput="$testOutput $test,Passed"
+        testOutput="$testOutput $test,Passed,$retries"
         ((num_passes++))
     fi
 
@@ -119,6 +462,17 @@ echo -e "  Total tests: $num_tests"
 echo -e "  Number of test passes: ${Bold}$num_passes ($percent_passing%)${Clear}"
 echo -e "  ${TestOutputColor}Number of test failures: ${Bold}$num_fails ${Clear}"
 
+# Merge the traces of all the tests into one timeline, every event of a trace is on its own line
+if [[ "$TRACE_FILE" != "" ]] ; then
+    {
+        echo '{"traceEvents": ['
+        cat $logDir/*.trace.json 2>/dev/null | grep '^{"name"' | sed 's/,$//' | sed '$!s/$/,/'
+        echo '],'
+        echo '"displayTimeUnit": "ms"}'
+    } > $TRACE_FILE
+    echo "Trace of the harness written to $TRACE_FILE"
+fi
+
 # Create an XML file with all the output
 if [[ "$GENERATE_XML" = "1" ]]
 then
@@ -137,9 +491,11 @@ then
     do
         testName=$(echo $test | cut -d, -f 1)
         testResult=$(echo $test | cut -d, -f 2)
+        testRetries=$(echo $test | cut -d, -f 3)
         echo -e "\t\t<test>" >> $xmlOutputFile
         echo -e "\t\t\t<name>$testName</name>" >> $xmlOutputFile
         echo -e "\t\t\t<result>$testResult</result>" >> $xmlOutputFile
+        echo -e "\t\t\t<retries>$testRetries</retries>" >> $xmlOutputFile
         echo -e "\t\t</test>" >> $xmlOutputFile
     done
     echo -e "\t</tests>" >> $xmlOutputFile
@@ -27,8 +27,8 @@
 using namespace Dali;
 using Dali::Toolkit::TextLabel;
 
-const char* BLEND_IMAGE=TEST_IMAGE_DIR "advanced-blending-mode/gallery-large-19.jpg";
-const char* EXPECTED_IMAGE_FILE=TEST_IMAGE_DIR "advanced-blending-mode/expected-result.png";
+const std::string BLEND_IMAGE=TestImagePath("advanced-blending-mode/gallery-large-19.jpg");
+const std::string EXPECTED_IMAGE_FILE=TestImagePath("advanced-blending-mode/expected-result.png");
 
 class AdvancedBlendingModeTest : public VisualTest
 {
@@ -117,7 +117,10 @@ public:
 
   void PostRender(std::string outputFile, bool success)
   {
-    CompareImageFile(EXPECTED_IMAGE_FILE, outputFile, 0.98f);
+    if(!CompareImageFile(EXPECTED_IMAGE_FILE, outputFile, 0.98f) && RetryCapture())
+    {
+      return;
+    }
     mApplication.Quit();
   }
 
@@ -29,30 +29,30 @@ using namespace Dali::Toolkit;
 
 namespace
 {
-constexpr const char* IMAGES[] =
+const std::string IMAGES[] =
 {
-  TEST_IMAGE_DIR "alpha-blending-cpu/people-small-7b.jpg", // 100x100
-  TEST_IMAGE_DIR "alpha-blending-cpu/people-medium-7.jpg",
-  TEST_IMAGE_DIR "alpha-blending-cpu/people-medium-7-rgb565.png", // is compressed
-  TEST_IMAGE_DIR "alpha-blending-cpu/people-medium-7-masked.png"  // has alpha channel
+  TestImagePath("alpha-blending-cpu/people-small-7b.jpg"), // 100x100
+  TestImagePath("alpha-blending-cpu/people-medium-7.jpg"),
+  TestImagePath("alpha-blending-cpu/people-medium-7-rgb565.png"), // is compressed
+  TestImagePath("alpha-blending-cpu/people-medium-7-masked.png")  // has alpha channel
 };
 constexpr auto IMAGE_COUNT = sizeof(IMAGES) / sizeof(IMAGES[0]);
 
 struct MaskMode
 {
-  const char* url              = nullptr;
+  const std::string url;
   const float maskContentScale = 1.0f;
   const bool  cropToMask       = false;
 };
-constexpr MaskMode MASK_MODES[] =
+const MaskMode MASK_MODES[] =
 {
   {},                                          // No mask
-  {TEST_IMAGE_DIR "alpha-blending-cpu/store_mask_profile_n.png"}, // 300x300 mask with default scale & crop
-  {TEST_IMAGE_DIR "alpha-blending-cpu/store_mask_profile_f.png", 1.6f, true},
+  {TestImagePath("alpha-blending-cpu/store_mask_profile_n.png")}, // 300x300 mask with default scale & crop
+  {TestImagePath("alpha-blending-cpu/store_mask_profile_f.png"), 1.6f, true},
 };
 constexpr auto  MASK_MODE_COUNT = sizeof(MASK_MODES) / sizeof(MASK_MODES[0]);
 constexpr float IMAGE_SIZE = 200.0f;
-constexpr const char* EXPECTED_IMAGE_FILE = TEST_IMAGE_DIR "alpha-blending-cpu/expected-result-1.png";
+const std::string EXPECTED_IMAGE_FILE = TestImagePath("alpha-blending-cpu/expected-result-1.png");
 
 constexpr auto NUMBER_OF_IMAGES = IMAGE_COUNT * MASK_MODE_COUNT;
 constexpr int WINDOW_WIDTH = MASK_MODE_COUNT * IMAGE_SIZE;
@@ -94,11 +94,11 @@ public:
         defaultWindow.Add(imageView);
 
         Property::Map map;
-        const char*   maskUrl  = MASK_MODES[mask].url;
-        const char*   imageUrl = IMAGES[image];
+        const std::string& maskUrl  = MASK_MODES[mask].url;
+        const std::string& imageUrl = IMAGES[image];
         map.Add(Toolkit::Visual::Property::TYPE, Toolkit::Visual::Type::IMAGE);
         map.Add(Toolkit::ImageVisual::Property::URL, imageUrl);
-        if(maskUrl)
+        if(!maskUrl.empty())
         {
           map.Add(Toolkit::ImageVisual::Property::ALPHA_MASK_URL, maskUrl);
           map.Add(Toolkit::ImageVisual::Property::MASK_CONTENT_SCALE, MASK_MODES[mask].maskContentScale);
@@ -124,7 +124,10 @@ private:
 
   void PostRender(std::string outputFile, bool success)
   {
-    CompareImageFile(EXPECTED_IMAGE_FILE, outputFile, 0.98f);
+    if(!CompareImageFile(EXPECTED_IMAGE_FILE, outputFile, 0.98f) && RetryCapture())
+    {
+      return;
+    }
     mApplication.Quit();
   }
 
@@ -40,15 +40,15 @@ using Dali::Integration::ToPropertyValue;
 namespace {
 // Resource for drawing
 const std::string JPG_FILENAME =
-    TEST_IMAGE_DIR "corner-radius-visual/gallery-medium-16.jpg";
+    TestImagePath("corner-radius-visual/gallery-medium-16.jpg");
 const std::string SVG_FILENAME =
-    TEST_IMAGE_DIR "corner-radius-visual/Contacts.svg";
+    TestImagePath("corner-radius-visual/Contacts.svg");
 const std::string ANIMATED_WEBP_FILENAME =
-    TEST_IMAGE_DIR "corner-radius-visual/dog-anim.webp";
+    TestImagePath("corner-radius-visual/dog-anim.webp");
 
 // Resource for visual comparison
 const std::string EXPECTED_IMAGE_FILE =
-    TEST_IMAGE_DIR "borderline-control/expected-result.png";
+    TestImagePath("borderline-control/expected-result.png");
 
 /**
  * @brief Test area for each visuals
@@ -139,12 +139,16 @@ enum TestStep {
   CREATE_ANIMATE_NO_PREMULTIPLIED_STEP,
   NUMBER_OF_STEPS
 };
-constexpr static int TERMINATE_RUNTIME = 10 * 1000; // 10 seconds
+const char *const STEP_NAMES[NUMBER_OF_STEPS] = {
+    "static-premultiplied",
+    "static-no-premultiplied",
+    "animate-premultiplied",
+    "animate-no-premultiplied",
+};
+constexpr static uint32_t STEP_MAX_WAIT = 10 * 1000; // 10 seconds per step
+constexpr static uint32_t STEP_TIMEOUT = STEP_MAX_WAIT + STEP_WATCHDOG_MARGIN;
 
-static int gTestStep = -1;
 static int gResourceReadyCount = 0;
-static bool gAnimationFinished = true;
-static bool gTermiatedTest = false;
 
 static std::unordered_set<int32_t> gResourceReadySet;
 
@@ -155,7 +159,8 @@ static std::unordered_set<int32_t> gResourceReadySet;
  */
 class BorderlineControlTest : public VisualTest {
 public:
-  BorderlineControlTest(Application &application) : mApplication(application) {}
+  BorderlineControlTest(Application &application)
+      : mApplication(application), mSequencer(*this) {}
 
   ~BorderlineControlTest() {}
 
@@ -165,92 +170,59 @@ public:
         Color::BLACK); // Due to the dog-anim.webp is white background, we make
                        // window black.
 
-    mTerminateTimer = Timer::New(TERMINATE_RUNTIME);
-    mTerminateTimer.TickSignal().Connect(
-        this, &BorderlineControlTest::OnTerminateTimer);
-    mTerminateTimer.Start();
-
-    PrepareNextTest();
-  }
-
-private:
-  bool OnTerminateTimer() {
-    // Visual Test Timout!
-    printf("TIMEOUT borderine-control.test spend more than %d ms\n",
-           TERMINATE_RUNTIME);
-
-    gTermiatedTest = true;
-    gExitValue = -1;
-    mApplication.Quit();
-
-    exit(gExitValue);
-
-    return false;
-  }
-
-  void PrepareNextTest() {
-    Window window = mApplication.GetWindow();
-
-    gTestStep++;
-
-    switch (gTestStep) {
-    case CREATE_STATIC_PREMULTIPLIED_STEP:
-    case CREATE_STATIC_NO_PREMULTIPLIED_STEP:
-    case CREATE_ANIMATE_PREMULTIPLIED_STEP:
-    case CREATE_ANIMATE_NO_PREMULTIPLIED_STEP: {
-      CreateVisuals((gTestStep == CREATE_ANIMATE_PREMULTIPLIED_STEP) ||
-                        (gTestStep == CREATE_ANIMATE_NO_PREMULTIPLIED_STEP),
-                    (gTestStep == CREATE_STATIC_PREMULTIPLIED_STEP) ||
-                        (gTestStep == CREATE_ANIMATE_PREMULTIPLIED_STEP));
-      break;
-    }
-    default:
-      break;
+    // Each step creates all the visuals again, and is captured once they are
+    // all ready and their animation, if any, has finished
+    for (int step = 0; step < NUMBER_OF_STEPS; ++step) {
+      const bool isAnimation = (step == CREATE_ANIMATE_PREMULTIPLIED_STEP) ||
+                               (step == CREATE_ANIMATE_NO_PREMULTIPLIED_STEP);
+      const bool preMultipliedAlpha =
+          (step == CREATE_STATIC_PREMULTIPLIED_STEP) ||
+          (step == CREATE_ANIMATE_PREMULTIPLIED_STEP);
+      mSequencer.AddStep(STEP_NAMES[step])
+          .Do([this, isAnimation, preMultipliedAlpha]() {
+            UnparentAllControls();
+            CreateVisuals(isAnimation, preMultipliedAlpha);
+          })
+          .WaitUntil([]() { return gResourceReadyCount == TOTAL_RESOURCES; })
+          .WaitForAnimation([this]() { return mAnimation; })
+          .MaxWait(STEP_MAX_WAIT)
+          .Capture();
     }
-  }
 
-  void OnFinishedAnimation(Animation animation) {
-    // Animation done. Check we need to go to next step
-    gAnimationFinished = true;
-    if (gAnimationFinished && gResourceReadyCount == TOTAL_RESOURCES) {
-      CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-    }
+    mSequencer.SetFinishedCallback([this]() { mApplication.Quit(); });
+    mSequencer.Start(mWindow);
   }
 
+private:
   void OnReady(Dali::Toolkit::Control control) {
-    // Resource ready done. Check we need to go to next step
+    // The controls are counted by id, as they are created by the step
     if (gResourceReadySet.find(control.GetProperty<int>(Actor::Property::ID)) !=
         gResourceReadySet.end()) {
       gResourceReadySet.erase(control.GetProperty<int>(Actor::Property::ID));
       gResourceReadyCount++;
-      if (gAnimationFinished && gResourceReadyCount == TOTAL_RESOURCES) {
-        CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-      }
+      IncrementResourceReadyCount();
     }
   }
 
   void PostRender(std::string outputFile, bool success) {
-    CompareImageFile(EXPECTED_IMAGE_FILE, outputFile, 0.98f);
-    if (gTestStep < NUMBER_OF_STEPS - 1) {
-      UnparentAllControls();
-      PrepareNextTest();
-    } else {
-      // The last check has been done, so we can quit the test
-      mTerminateTimer.Stop();
-      mApplication.Quit();
+    if (!CompareImageFile(EXPECTED_IMAGE_FILE, outputFile, 0.98f) &&
+        RetryCapture()) {
+      return;
     }
+    mSequencer.Next();
   }
 
 private:
   void CreateVisuals(bool isAnimation, bool requiredPreMulitpliedAlpha) {
     // Reset resource ready count
     gResourceReadyCount = 0;
-    gAnimationFinished = true;
+    SetExpectedResourceCount(TOTAL_RESOURCES);
+    gResourceReadySet.clear();
 
     // If isAnimation, create new super-fast animation.
+    mAnimation.Reset();
     if (isAnimation) {
       mAnimation = Animation::New(0.001f); // seconds
-      gAnimationFinished = false;
     }
 
     // Create Visuals for each testset types.
@@ -266,10 +238,8 @@ private:
     }
 
     if (isAnimation) {
-      // Wait until all animations are finished.
-      mAnimation.FinishedSignal().Connect(
-          this, &BorderlineControlTest::OnFinishedAnimation);
-      mAnimation.Play();
+      // The step waits until all animations are finished.
+      mSequencer.GetClock().PlayToEnd(mAnimation);
     }
   }
 
@@ -466,13 +436,14 @@ private:
 
 private:
   Application &mApplication;
+  StepSequencer mSequencer;
   Window mWindow;
-  Timer mTerminateTimer;
   Animation mAnimation;
   std::vector<Control> mControlList;
 };
 
-DALI_VISUAL_TEST_WITH_WINDOW_SIZE(
+DALI_VISUAL_TEST_WITH_STEPS(
     BorderlineControlTest, OnInit,
     TESTSET_VISUAL_SIZE *NUMBER_OF_PROPERTY_TYPES,
-    TESTSET_VISUAL_SIZE *NUMBER_OF_VALID_VISUAL_TYPES)
+    TESTSET_VISUAL_SIZE *NUMBER_OF_VALID_VISUAL_TYPES,
+    NUMBER_OF_STEPS, STEP_TIMEOUT)
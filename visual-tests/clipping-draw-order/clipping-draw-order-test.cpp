@@ -30,17 +30,17 @@ using namespace Dali::Toolkit;
 
 namespace
 {
-constexpr const char* IMAGES[] = {
-  TEST_IMAGE_DIR "clipping-draw-order/gallery-small-1.jpg",
-  TEST_IMAGE_DIR "clipping-draw-order/gallery-small-2.jpg",
-  TEST_IMAGE_DIR "clipping-draw-order/gallery-small-3.jpg",
-  TEST_IMAGE_DIR "clipping-draw-order/gallery-small-4.jpg",
-  TEST_IMAGE_DIR "clipping-draw-order/gallery-small-5.jpg"
+const std::string IMAGES[] = {
+  TestImagePath("clipping-draw-order/gallery-small-1.jpg"),
+  TestImagePath("clipping-draw-order/gallery-small-2.jpg"),
+  TestImagePath("clipping-draw-order/gallery-small-3.jpg"),
+  TestImagePath("clipping-draw-order/gallery-small-4.jpg"),
+  TestImagePath("clipping-draw-order/gallery-small-5.jpg")
 };
 constexpr auto NUMBER_OF_IMAGES = sizeof(IMAGES) / sizeof(IMAGES[0]);
 constexpr auto NUMBER_OF_IMAGE_VIEWS = NUMBER_OF_IMAGES * 2;
 
-constexpr const char* EXPECTED_RESULT_IMAGE = TEST_IMAGE_DIR "clipping-draw-order/expected-result-1.png";
+const std::string EXPECTED_RESULT_IMAGE = TestImagePath("clipping-draw-order/expected-result-1.png");
 
 constexpr int WINDOW_WIDTH = 480;
 constexpr int WINDOW_HEIGHT = 800;
@@ -172,7 +172,10 @@ private:
 
   void PostRender(std::string outputFile, bool success)
   {
-    CompareImageFile(EXPECTED_RESULT_IMAGE, outputFile, 0.98f);
+    if(!CompareImageFile(EXPECTED_RESULT_IMAGE, outputFile, 0.98f) && RetryCapture())
+    {
+      return;
+    }
     mApplication.Quit();
   }
 
@@ -30,21 +30,10 @@ using namespace Dali::Toolkit;
 namespace
 {
 
-const std::string IMAGE_FILE_1 = TEST_IMAGE_DIR "clipping-mode/expected-result-1.png";
-const std::string IMAGE_FILE_2 = TEST_IMAGE_DIR "clipping-mode/expected-result-2.png";
-const std::string IMAGE_FILE_3 = TEST_IMAGE_DIR "clipping-mode/expected-result-3.png";
-const std::string IMAGE_FILE_4 = TEST_IMAGE_DIR "clipping-mode/expected-result-4.png";
-
-enum TestStep
-{
-  CLIP_CHILDREN_01,
-  CLIP_CHILDREN_02,
-  CLIP_TO_BOUNDING_BOX_01,
-  CLIP_TO_BOUNDING_BOX_02,
-  NUMBER_OF_STEPS
-};
-
-static int gTestStep = -1;
+const std::string IMAGE_FILE_1 = TestImagePath("clipping-mode/expected-result-1.png");
+const std::string IMAGE_FILE_2 = TestImagePath("clipping-mode/expected-result-2.png");
+const std::string IMAGE_FILE_3 = TestImagePath("clipping-mode/expected-result-3.png");
+const std::string IMAGE_FILE_4 = TestImagePath("clipping-mode/expected-result-4.png");
 
 }  // namespace
 
@@ -56,7 +45,8 @@ class ClippingModeTest: public VisualTest
  public:
 
   ClippingModeTest( Application& application )
-    : mApplication( application )
+    : mApplication( application ),
+      mSequencer( *this )
   {
   }
 
@@ -65,8 +55,27 @@ class ClippingModeTest: public VisualTest
     Dali::Window window = mApplication.GetWindow();
     window.SetBackgroundColor(Color::WHITE);
 
+    mSequencer.AddStep( "clip-children-01" ).Do( [this]() { CreateSimpleScene(ClippingMode::CLIP_CHILDREN); } ).Capture();
+    mSequencer.AddStep( "clip-children-02" ).Do( [this]()
+    {
+      RemoveScene();
+      CreateComplextScene(ClippingMode::CLIP_CHILDREN);
+    } ).Capture();
+    mSequencer.AddStep( "clip-to-bounding-box-01" ).Do( [this]()
+    {
+      RemoveScene();
+      CreateSimpleScene(ClippingMode::CLIP_TO_BOUNDING_BOX);
+    } ).Capture();
+    mSequencer.AddStep( "clip-to-bounding-box-02" ).Do( [this]()
+    {
+      RemoveScene();
+      CreateComplextScene(ClippingMode::CLIP_TO_BOUNDING_BOX);
+    } ).Capture();
+
+    mSequencer.SetFinishedCallback( [this]() { mApplication.Quit(); } );
+
     // Start the test
-    PerformNextTest();
+    mSequencer.Start( window );
   }
 
 private:
@@ -183,68 +192,23 @@ private:
     mContainer.Unparent();
   }
 
-  void PerformNextTest()
-  {
-    Window window = mApplication.GetWindow();
-
-    gTestStep++;
-    switch(gTestStep)
-    {
-      case CLIP_CHILDREN_01:
-      {
-        CreateSimpleScene(ClippingMode::CLIP_CHILDREN);
-        CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-        break;
-      }
-      case CLIP_CHILDREN_02:
-      {
-        RemoveScene();
-        CreateComplextScene(ClippingMode::CLIP_CHILDREN);
-        CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-        break;
-      }
-      case CLIP_TO_BOUNDING_BOX_01:
-      {
-        RemoveScene();
-        CreateSimpleScene(ClippingMode::CLIP_TO_BOUNDING_BOX);
-        CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-        break;
-      }
-      case CLIP_TO_BOUNDING_BOX_02:
-      {
-        RemoveScene();
-        CreateComplextScene(ClippingMode::CLIP_TO_BOUNDING_BOX);
-        CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-        break;
-      }
-      default:
-      {
-        break;
-      }
-    }
-  }
-
   void PostRender(std::string outputFile, bool success)
   {
     const std::string images[] = { IMAGE_FILE_1, IMAGE_FILE_2, IMAGE_FILE_3, IMAGE_FILE_4 };
 
-    CompareImageFile(images[gTestStep], outputFile, 0.98f);
-
-    if(gTestStep < NUMBER_OF_STEPS-1)
-    {
-      PerformNextTest();
-    }
-    else
+    if(!CompareImageFile(images[mSequencer.GetCurrentStep()], outputFile, 0.98f) && RetryCapture())
     {
-      mApplication.Quit();
+      return;
     }
+
+    mSequencer.Next();
   }
 
 private:
 
   Application& mApplication;
+  StepSequencer mSequencer;
   Actor mContainer;
-  Timer mTimer;
 };
 
 DALI_VISUAL_TEST( ClippingModeTest, OnInit )
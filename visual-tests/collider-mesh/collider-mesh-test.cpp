@@ -38,17 +38,8 @@ using Dali::Integration::ToDaliStringView;
 using namespace Dali;
 using namespace Dali::Toolkit;
 
-// set macros to satisfy intellisense when outside of build system
-#ifndef TEST_IMAGE_DIR
-#define TEST_IMAGE_DIR
-#endif
-
-#ifndef TEST_RESOURCES_DIR
-#define TEST_RESOURCES_DIR
-#endif
-
 namespace {
-const std::string IMAGE_FILE = TEST_IMAGE_DIR "collider-mesh/ColliderMeshTest0";
+const std::string IMAGE_FILE = TestImagePath("collider-mesh/ColliderMeshTest0");
 
 } // namespace
 
@@ -59,7 +50,8 @@ const std::string IMAGE_FILE = TEST_IMAGE_DIR "collider-mesh/ColliderMeshTest0";
  */
 class ColliderMeshTest : public VisualTest {
 public:
-  ColliderMeshTest(Application &application) : mApplication(application) {}
+  ColliderMeshTest(Application &application)
+      : mApplication(application), mSequencer(*this) {}
 
   void OnInit(Application application) {
     Dali::Window window = mApplication.GetWindow();
@@ -81,7 +73,7 @@ public:
 
     // Load the model and set IBL
     Scene3D::Model model =
-        Scene3D::Model::New(TEST_RESOURCES_DIR "collider-mesh/floors2.gltf");
+        Scene3D::Model::New(TestResourcesPath("collider-mesh/floors2.gltf"));
     model.SetProperties(CreatePropertyMap({
         {Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER},
         {Actor::Property::PIVOT, Pivot::CENTER},
@@ -123,11 +115,11 @@ private:
     [[maybe_unused]] auto room2 = model.FindChildModelNodeByName("room2");
 
     auto collider0 = Scene3D::Loader::NavigationMeshFactory::CreateFromFile(
-        TEST_RESOURCES_DIR "collider-mesh/room0.col");
+        TestResourcesPath("collider-mesh/room0.col"));
     auto collider1 = Scene3D::Loader::NavigationMeshFactory::CreateFromFile(
-        TEST_RESOURCES_DIR "collider-mesh/room1.col");
+        TestResourcesPath("collider-mesh/room1.col"));
     auto collider2 = Scene3D::Loader::NavigationMeshFactory::CreateFromFile(
-        TEST_RESOURCES_DIR "collider-mesh/room2.col");
+        TestResourcesPath("collider-mesh/room2.col"));
 
     // unparent one node to simulate case of setting the collider mesh while
     // node is not a part of model tree
@@ -141,50 +133,43 @@ private:
     model.AddModelNode(room2);
 
     model.MeshHitSignal().Connect(this, &ColliderMeshTest::OnModelHit);
-    PerformNextTest(1000);
-  }
 
-  bool OnUpdate() {
-    if (mTestStep == 1) {
-      Dali::TouchPoint p(0, Dali::PointState::DOWN, 400, 400);
-      EmitTouch(p);
-    } else if (mTestStep == 2) {
-      Dali::TouchPoint p(0, Dali::PointState::DOWN, 798, 511);
-      EmitTouch(p);
-    } else if (mTestStep == 3) {
-      Dali::TouchPoint p(0, Dali::PointState::DOWN, 568, 238);
-      EmitTouch(p);
-    } else if (mTestStep == 4) {
-      mApplication.Quit();
-    }
-    CaptureWindowAfterFrameRendered(mWindow);
-    mTestStep++;
-    return false;
+    // The colours set on a hit are applied by the next update, so each step
+    // waits for a couple of frames rather than a fixed time
+    mSequencer.AddStep("initial").WaitForFrames(2).Capture();
+    mSequencer.AddStep("no-hit").WaitForFrames(2).Capture();
+    AddTouchStep("touch-room0", 400, 400);
+    AddTouchStep("touch-room1", 798, 511);
+    AddTouchStep("touch-room2", 568, 238);
+    mSequencer.SetFinishedCallback([this]() { mApplication.Quit(); });
+    mSequencer.Start(mWindow);
   }
 
-  Dali::Timer mTimer;
-
-  void PerformNextTest(uint32_t millisDelay = 0) {
-    mTimer.Reset();
-    // check previous step
-    mTimer = Dali::Timer::New(1000);
-    mTimer.TickSignal().Connect(this, &ColliderMeshTest::OnUpdate);
-    mTimer.Start();
+  void AddTouchStep(const std::string &name, float x, float y) {
+    mSequencer.AddStep(name)
+        .Do([this, x, y]() {
+          Dali::TouchPoint point(0, Dali::PointState::DOWN, x, y);
+          EmitTouch(point);
+        })
+        .WaitForFrames(2)
+        .Capture();
   }
 
   void PostRender(std::string outputFile, bool success) override {
     std::string fname(IMAGE_FILE);
-    fname += std::to_string(mTestStep + 1);
+    fname += std::to_string(mSequencer.GetCurrentStep() + 1);
     fname += ".png";
-    CompareImageFile(fname, outputFile, 0.98f);
-    PerformNextTest(1000);
+    if (!CompareImageFile(fname, outputFile, 0.98f) && RetryCapture()) {
+      return;
+    }
+    mSequencer.Next();
   }
 
 private:
   Application &mApplication;
   Dali::Window mWindow;
   Scene3D::SceneView mSceneView;
-  int mTestStep{-1};
+  StepSequencer mSequencer;
 };
 
 DALI_VISUAL_TEST_WITH_WINDOW_SIZE(ColliderMeshTest, OnInit, 1280, 720)
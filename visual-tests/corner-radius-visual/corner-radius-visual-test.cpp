@@ -40,18 +40,18 @@ using Dali::Integration::ToPropertyValue;
 namespace {
 // Resource for drawing
 const std::string JPG_FILENAME =
-    TEST_IMAGE_DIR "corner-radius-visual/gallery-medium-16.jpg";
+    TestImagePath("corner-radius-visual/gallery-medium-16.jpg");
 const std::string SVG_FILENAME =
-    TEST_IMAGE_DIR "corner-radius-visual/Contacts.svg";
+    TestImagePath("corner-radius-visual/Contacts.svg");
 const std::string ANIMATED_WEBP_FILENAME =
-    TEST_IMAGE_DIR "corner-radius-visual/dog-anim.webp";
-// const std::string ANIMATED_LOTTIE_FILENAME = TEST_IMAGE_DIR
-// "corner-radius-visual/jolly_walker.json"; ///< We need rlottie and
+    TestImagePath("corner-radius-visual/dog-anim.webp");
+// const std::string ANIMATED_LOTTIE_FILENAME =
+// TestImagePath("corner-radius-visual/jolly_walker.json"); ///< We need rlottie and
 // dali-extension. so just skip
 
 // Resource for visual comparison
 const std::string EXPECTED_IMAGE_FILE =
-    TEST_IMAGE_DIR "corner-radius-visual/expected-result.png";
+    TestImagePath("corner-radius-visual/expected-result.png");
 
 /**
  * @brief Test area for each visuals
@@ -133,12 +133,16 @@ enum TestStep {
   CREATE_ANIMATE_RELATIVE_STEP,
   NUMBER_OF_STEPS
 };
-constexpr static int TERMINATE_RUNTIME = 10 * 1000; // 10 seconds
+const char *const STEP_NAMES[NUMBER_OF_STEPS] = {
+    "static-absolute",
+    "static-relative",
+    "animate-absolute",
+    "animate-relative",
+};
+constexpr static uint32_t STEP_MAX_WAIT = 10 * 1000; // 10 seconds per step
+constexpr static uint32_t STEP_TIMEOUT = STEP_MAX_WAIT + STEP_WATCHDOG_MARGIN;
 
-static int gTestStep = -1;
 static int gResourceReadyCount = 0;
-static bool gAnimationFinished = true;
-static bool gTerminatedTest = false;
 
 static std::unordered_set<int32_t> gResourceReadySet;
 
@@ -150,7 +154,7 @@ static std::unordered_set<int32_t> gResourceReadySet;
 class CornerRadiusVisualTest : public VisualTest {
 public:
   CornerRadiusVisualTest(Application &application)
-      : mApplication(application) {}
+      : mApplication(application), mSequencer(*this) {}
 
   ~CornerRadiusVisualTest() {}
 
@@ -160,95 +164,59 @@ public:
         Color::BLACK); // Due to the dog-anim.webp is white background, we make
                        // window black.
 
-    mTerminateTimer = Timer::New(TERMINATE_RUNTIME);
-    mTerminateTimer.TickSignal().Connect(
-        this, &CornerRadiusVisualTest::OnTerminateTimer);
-    mTerminateTimer.Start();
+    // Each step creates all the controls again, and is captured once they are
+    // all ready and their animation, if any, has finished
+    for (int step = 0; step < NUMBER_OF_STEPS; ++step) {
+      const bool isAnimation = (step == CREATE_ANIMATE_ABSOLUTE_STEP) ||
+                               (step == CREATE_ANIMATE_RELATIVE_STEP);
+      const bool isRelative = (step == CREATE_STATIC_RELATIVE_STEP) ||
+                              (step == CREATE_ANIMATE_RELATIVE_STEP);
+      mSequencer.AddStep(STEP_NAMES[step])
+          .Do([this, isAnimation, isRelative]() {
+            UnparentAllControls();
+            CreateVisuals(isAnimation, isRelative);
+          })
+          .WaitUntil([]() { return gResourceReadyCount == TOTAL_RESOURCES; })
+          .WaitForAnimation([this]() { return mAnimation; })
+          .MaxWait(STEP_MAX_WAIT)
+          .Capture();
+    }
 
-    // Start the test
-    PrepareNextTest();
+    mSequencer.SetFinishedCallback([this]() { mApplication.Quit(); });
+    mSequencer.Start(mWindow);
   }
 
 private:
-  bool OnTerminateTimer() {
-    // Visual Test Timout!
-    printf("TIMEOUT corner-radius-visual.test spend more than %d ms\n",
-           TERMINATE_RUNTIME);
-
-    gTerminatedTest = true;
-    gExitValue = -1;
-    mApplication.Quit();
-
-    exit(gExitValue);
-
-    return false;
-  }
-
-  void PrepareNextTest() {
-    gTestStep++;
-
-    Window window = mApplication.GetWindow();
-
-    switch (gTestStep) {
-    case CREATE_STATIC_ABSOLUTE_STEP:
-    case CREATE_STATIC_RELATIVE_STEP:
-    case CREATE_ANIMATE_ABSOLUTE_STEP:
-    case CREATE_ANIMATE_RELATIVE_STEP: {
-      CreateVisuals((gTestStep == CREATE_ANIMATE_ABSOLUTE_STEP) ||
-                        (gTestStep == CREATE_ANIMATE_RELATIVE_STEP),
-                    (gTestStep == CREATE_STATIC_RELATIVE_STEP) ||
-                        (gTestStep == CREATE_ANIMATE_RELATIVE_STEP));
-      break;
-    }
-    default:
-      break;
-    }
-  }
-
   void OnReady(Dali::Toolkit::Control control) {
-    // Resource ready done. Check we need to go to next step
+    // The controls are counted by id, as they are created by the step
     if (gResourceReadySet.find(control.GetProperty<int>(Actor::Property::ID)) !=
         gResourceReadySet.end()) {
       gResourceReadySet.erase(control.GetProperty<int>(Actor::Property::ID));
       gResourceReadyCount++;
-      if (gAnimationFinished && gResourceReadyCount == TOTAL_RESOURCES) {
-        CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-      }
-    }
-  }
-
-  void OnFinishedAnimation(Animation animation) {
-    // Animation done. Check we need to go to next step
-    gAnimationFinished = true;
-    if (gAnimationFinished && gResourceReadyCount == TOTAL_RESOURCES) {
-      CaptureWindowAfterFrameRendered(mApplication.GetWindow());
+      IncrementResourceReadyCount();
     }
   }
 
   void PostRender(std::string outputFile, bool success) {
     // All steps will have same result.
-    CompareImageFile(EXPECTED_IMAGE_FILE, outputFile, 0.98f);
-    if (gTestStep + 1u == NUMBER_OF_STEPS) {
-      // The last check has been done, so we can quit the test
-      mTerminateTimer.Stop();
-      mApplication.Quit();
-    } else {
-      // Test done. Let's do next test!
-      UnparentAllControls();
-      PrepareNextTest();
+    if (!CompareImageFile(EXPECTED_IMAGE_FILE, outputFile, 0.98f) &&
+        RetryCapture()) {
+      return;
     }
+    mSequencer.Next();
   }
 
 private:
   void CreateVisuals(bool isAnimation, bool isRelative) {
     // Reset resource ready count
     gResourceReadyCount = 0;
-    gAnimationFinished = true;
+    SetExpectedResourceCount(TOTAL_RESOURCES);
+    gResourceReadySet.clear();
 
     // If isAnimation, create new super-fast animation.
+    mAnimation.Reset();
     if (isAnimation) {
       mAnimation = Animation::New(0.001f); // seconds
-      gAnimationFinished = false;
     }
 
     // Create Visuals for each testset types.
@@ -264,10 +232,8 @@ private:
     }
 
     if (isAnimation) {
-      // Wait until all animations are finished.
-      mAnimation.FinishedSignal().Connect(
-          this, &CornerRadiusVisualTest::OnFinishedAnimation);
-      mAnimation.Play();
+      // The step waits until all animations are finished.
+      mSequencer.GetClock().PlayToEnd(mAnimation);
     }
   }
 
@@ -490,13 +456,14 @@ private:
 
 private:
   Application &mApplication;
+  StepSequencer mSequencer;
   Window mWindow;
-  Timer mTerminateTimer;
   Animation mAnimation;
   std::vector<Control> mControlList;
 };
 
-DALI_VISUAL_TEST_WITH_WINDOW_SIZE(
+DALI_VISUAL_TEST_WITH_STEPS(
     CornerRadiusVisualTest, OnInit,
     TESTSET_VISUAL_SIZE *NUMBER_OF_PROPERTY_TYPES,
-    TESTSET_VISUAL_SIZE *NUMBER_OF_VALID_VISUAL_TYPES)
+    TESTSET_VISUAL_SIZE *NUMBER_OF_VALID_VISUAL_TYPES,
+    NUMBER_OF_STEPS, STEP_TIMEOUT)
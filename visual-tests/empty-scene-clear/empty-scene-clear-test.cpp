@@ -32,15 +32,11 @@ using namespace Dali::Toolkit;
 namespace {
 
 const std::string IMAGE_FILE_1 =
-    TEST_IMAGE_DIR "empty-scene-clear/expected-result-1.png";
+    TestImagePath("empty-scene-clear/expected-result-1.png");
 const std::string IMAGE_FILE_2 =
-    TEST_IMAGE_DIR "empty-scene-clear/expected-result-2.png";
+    TestImagePath("empty-scene-clear/expected-result-2.png");
 const std::string IMAGE_FILE_3 =
-    TEST_IMAGE_DIR "empty-scene-clear/expected-result-3.png";
-
-enum TestStep { FIRST_WINDOW, SECOND_WINDOW, THIRD_WINDOW, NUMBER_OF_STEPS };
-
-static int gTestStep = -1;
+    TestImagePath("empty-scene-clear/expected-result-3.png");
 
 } // namespace
 
@@ -51,7 +47,8 @@ static int gTestStep = -1;
  */
 class EmptySceneClearTest : public VisualTest {
 public:
-  EmptySceneClearTest(Application &application) : mApplication(application) {}
+  EmptySceneClearTest(Application &application)
+      : mApplication(application), mSequencer(*this) {}
 
   void OnInit(Application application) {
     Dali::Window window = mApplication.GetWindow();
@@ -61,8 +58,25 @@ public:
     mTextLabel.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
     window.Add(mTextLabel);
 
-    // Start the test
-    PerformNextTest();
+    // Each step captures the window it has created
+    mSequencer.AddStep("first-window").Capture();
+    mSequencer.AddStep("second-window")
+        .Do([this]() {
+          // Create an empty window with no renderable actors
+          mSecondWindow = CreateNewWindow();
+          mSecondWindow.SetBackgroundColor(Color::CYAN);
+        })
+        .Capture([this]() { return mSecondWindow; });
+    mSequencer.AddStep("third-window")
+        .Do([this]() {
+          // Create another empty window with no renderable actors
+          mThirdWindow = CreateNewWindow();
+          mThirdWindow.SetBackgroundColor(Color::RED);
+        })
+        .Capture([this]() { return mThirdWindow; });
+
+    mSequencer.SetFinishedCallback([this]() { mApplication.Quit(); });
+    mSequencer.Start(window);
   }
 
 private:
@@ -73,49 +87,19 @@ private:
     return Dali::Window::New(windowSize, "New window", false);
   }
 
-  void PerformNextTest() {
-    gTestStep++;
-    switch (gTestStep) {
-    case FIRST_WINDOW: {
-      mTestWindow = mApplication.GetWindow();
-      CaptureWindowAfterFrameRendered(mTestWindow);
-      break;
-    }
-    case SECOND_WINDOW: {
-      // Create an empty window with no renderable actors
-      mSecondWindow = CreateNewWindow();
-      mSecondWindow.SetBackgroundColor(Color::CYAN);
-      mTestWindow = mSecondWindow;
-      CaptureWindowAfterFrameRendered(mTestWindow);
-      break;
-    }
-    case THIRD_WINDOW: {
-
-      // Create another empty window with no renderable actors
-      mThirdWindow = CreateNewWindow();
-      mThirdWindow.SetBackgroundColor(Color::RED);
-      mTestWindow = mThirdWindow;
-      CaptureWindowAfterFrameRendered(mTestWindow);
-      break;
-    }
-    default:
-      break;
-    }
-  }
-
   void PostRender(std::string outputFile, bool success) {
     const std::string images[] = {IMAGE_FILE_1, IMAGE_FILE_2, IMAGE_FILE_3};
-    CompareImageFile(images[gTestStep], outputFile, 0.95f);
-    if (gTestStep < THIRD_WINDOW) {
-      PerformNextTest();
-    } else {
-      mApplication.Quit();
+    if (!CompareImageFile(images[mSequencer.GetCurrentStep()], outputFile,
+                          0.95f) &&
+        RetryCapture()) {
+      return;
     }
+    mSequencer.Next();
   }
 
 private:
   Application &mApplication;
-  Dali::Window mTestWindow;
+  StepSequencer mSequencer;
   Dali::Window mSecondWindow;
   Dali::Window mThirdWindow;
   TextLabel mTextLabel;
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/dali.h>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "benchmark-test.h"
+#include "ktx-loader.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace {
+// The cube maps of the image based lighting of the scene3d scenes, by the
+// prefix of their measures
+const struct {
+  const char *name;
+  const char *file;
+} ENVIRONMENTS[] = {
+    {"radiance", "environments/Studio/Radiance.ktx"},
+    {"irradiance", "environments/Studio/Irradiance.ktx"},
+};
+
+// The number of loads of each cube map
+const int LOAD_RUNS = 5;
+
+// The frames updated after a load, by which the cube map has been uploaded
+const uint32_t FIRST_FRAME_WAIT = 3u;
+
+/**
+ * @brief The measures of one load of a cube map.
+ */
+struct EnvironmentLoad {
+  KtxProfile profile;
+  double firstFrameMs = -1.0; ///< From the start of the load, -1 if missing
+};
+
+} // namespace
+
+/**
+ * @brief This benchmark measures the loading of the environment maps of the
+ * scene3d scenes, the cost of the image based lighting at startup.
+ *
+ * Each cube map is loaded LOAD_RUNS times, each load in its own step, by the
+ * KTX loader of the harness (see LoadKtxTexture), which times the parsing and
+ * the decoding into pixel data of each mip level. The median of each is
+ * reported per level, e.g. "radiance.mip0.parse" and "radiance.mip0.decode",
+ * with that of the header, e.g. "radiance.header", and of the time from the
+ * start of the load to the first frame presented after it, e.g.
+ * "radiance.first-frame", by which the render thread has uploaded the whole
+ * cube map. The event thread only queues the uploads, so they are measured by
+ * the first frame rather than level by level.
+ */
+class EnvironmentLoadTest : public BenchmarkTest {
+public:
+  EnvironmentLoadTest(Application &application)
+      : mApplication(application), mSequencer(*this) {}
+
+  void OnInit(Application application) {
+    Dali::Window window = mApplication.GetWindow();
+    window.SetBackgroundColor(Color::WHITE);
+
+    for (const auto &environment : ENVIRONMENTS) {
+      const std::string name = environment.name;
+      const std::string path = TestScenePath(environment.file);
+      for (int run = 0; run < LOAD_RUNS; ++run) {
+        mSequencer.AddStep(name + "-" + std::to_string(run))
+            .Do([this, path]() { Load(path); })
+            .WaitForFrames(FIRST_FRAME_WAIT)
+            .Then([this, name, run]() { EndLoad(name, run); });
+      }
+    }
+
+    mSequencer.SetFinishedCallback([this]() { Finish(mApplication); });
+    mSequencer.Start(window);
+  }
+
+private:
+  /**
+   * @brief Load a cube map in place of the previous one, and ask for the time
+   * at which the first frame after it is presented.
+   */
+  void Load(const std::string &path) {
+    mTexture.Reset();
+
+    mLoad = EnvironmentLoad();
+    StartFirstFrameTimer();
+    mTexture = LoadKtxTexture(path, &mLoad.profile);
+    if (!mTexture) {
+      FailStep(path + " cannot be loaded");
+    }
+    TimeFirstFrame(mApplication.GetWindow());
+  }
+
+  /**
+   * @brief Keep the measures of a load, and report them once all the loads
+   * of the cube map are done.
+   */
+  void EndLoad(const std::string &name, int run) {
+    mLoad.firstFrameMs = GetFirstFrameMs();
+    if (mLoad.firstFrameMs < 0.0) {
+      FailStep("the first frame after " + name + " has not been presented");
+    }
+    mLoads.push_back(mLoad);
+    if (run + 1 < LOAD_RUNS) {
+      return;
+    }
+
+    ReportMedian(name + ".header", "ms", mLoads,
+                 [](const EnvironmentLoad &load) {
+                   return load.profile.headerMs;
+                 });
+    // The levels of every load, none if a load failed
+    size_t mipCount = mLoads.front().profile.mips.size();
+    for (const EnvironmentLoad &load : mLoads) {
+      mipCount = std::min(mipCount, load.profile.mips.size());
+    }
+    for (size_t mip = 0; mip < mipCount; ++mip) {
+      const std::string prefix = name + ".mip" + std::to_string(mip);
+      ReportMedian(prefix + ".parse", "ms", mLoads,
+                   [mip](const EnvironmentLoad &load) {
+                     return load.profile.mips[mip].parseMs;
+                   });
+      ReportMedian(prefix + ".decode", "ms", mLoads,
+                   [mip](const EnvironmentLoad &load) {
+                     return load.profile.mips[mip].decodeMs;
+                   });
+    }
+    ReportMedian(name + ".first-frame", "ms", mLoads,
+                 [](const EnvironmentLoad &load) { return load.firstFrameMs; });
+    mLoads.clear();
+  }
+
+private:
+  Application &mApplication;
+  StepSequencer mSequencer;
+  Texture mTexture;
+  EnvironmentLoad mLoad;
+  std::vector<EnvironmentLoad> mLoads;
+};
+
+DALI_BENCHMARK_TEST(EnvironmentLoadTest, OnInit, 480, 800,
+                    std::size(ENVIRONMENTS) * LOAD_RUNS, DEFAULT_STEP_TIMEOUT)
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/dali.h>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "benchmark-test.h"
+#include "memory-sampler.h"
+#include "mesh-blob.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace {
+// The scenes whose meshes are loaded, with the largest mesh files
+const std::string SCENES[] = {"exercise.dli", "robot.dli"};
+
+// The sources compared, each load of one is followed by a load of the other
+const MeshBlobSource SOURCES[] = {MESH_BLOB_READ, MESH_BLOB_MAPPED};
+
+// The number of loads of the meshes of a scene from each source
+const int LOAD_RUNS = 5;
+
+// The frames updated after a load, by which the meshes have been uploaded
+const uint32_t FIRST_FRAME_WAIT = 3u;
+
+// The meshes are only drawn so that they are uploaded
+const char *VERTEX_SHADER = R"(
+attribute mediump vec3 aPosition;
+uniform mediump mat4 uMvpMatrix;
+void main()
+{
+  gl_Position = uMvpMatrix * vec4(aPosition, 1.0);
+}
+)";
+
+const char *FRAGMENT_SHADER = R"(
+uniform lowp vec4 uColor;
+void main()
+{
+  gl_FragColor = uColor;
+}
+)";
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief The measures of one load of the meshes of a scene.
+ */
+struct MeshLoad {
+  double loadMs = 0.0;        ///< The time to create the geometry
+  uint64_t peakRssKb = 0u;    ///< The peak resident set size of the step
+  double firstFrameMs = -1.0; ///< From the start of the load, -1 if missing
+};
+
+} // namespace
+
+/**
+ * @brief This benchmark compares the two ways of giving the meshes of the DLI
+ * scenes to DALi (see CreateMeshGeometry): reading their ranges into heap
+ * buffers first, as Scene3D::Loader does, or giving them to the vertex
+ * buffers straight from a mapping of the mesh file.
+ *
+ * The meshes of each scene are loaded LOAD_RUNS times from each source, in
+ * turn, each load in its own step, and drawn until they have been uploaded.
+ * The median of the time to create the geometry, of the peak resident set
+ * size of the step and of the time from the start of the load to the first
+ * frame presented with the meshes is reported for each source, e.g.
+ * "robot.read.load", "robot.mapped.peak-rss" and "robot.mapped.first-frame".
+ */
+class MeshBlobLoadTest : public BenchmarkTest {
+public:
+  MeshBlobLoadTest(Application &application)
+      : mApplication(application), mSequencer(*this) {}
+
+  void OnInit(Application application) {
+    Dali::Window window = mApplication.GetWindow();
+    window.SetBackgroundColor(Color::WHITE);
+
+    mShader = Shader::New(VERTEX_SHADER, FRAGMENT_SHADER);
+    mMeshLayer = Layer::New();
+    mMeshLayer.SetResizePolicy(ResizePolicy::FILL_TO_PARENT,
+                               Dimension::ALL_DIMENSIONS);
+    window.Add(mMeshLayer);
+
+    for (const std::string &scene : SCENES) {
+      const std::string name = scene.substr(0, scene.rfind('.'));
+      std::vector<MeshBlob> blobs = GetSceneMeshBlobs(
+          TestScenePath("models/" + scene), TestScenePath("models/"));
+      for (int run = 0; run < LOAD_RUNS; ++run) {
+        for (MeshBlobSource source : SOURCES) {
+          const std::string prefix =
+              name + "." + GetMeshBlobSourceName(source);
+          mSequencer.AddStep(prefix + "-" + std::to_string(run))
+              .Do([this, blobs, source]() { Load(blobs, source); })
+              .WaitForFrames(FIRST_FRAME_WAIT)
+              .Then([this, prefix, source, run]() {
+                EndLoad(prefix, source, run);
+              });
+        }
+      }
+    }
+
+    mSequencer.SetFinishedCallback([this]() { Finish(mApplication); });
+    mSequencer.Start(window);
+  }
+
+private:
+  /**
+   * @brief Create the geometry of the meshes in place of the previous ones,
+   * and ask for the time at which the first frame with them is presented.
+   */
+  void Load(const std::vector<MeshBlob> &blobs, MeshBlobSource source) {
+    UnparentAndReset(mMeshes);
+    mMeshes = Actor::New();
+    mMeshes.SetResizePolicy(ResizePolicy::FILL_TO_PARENT,
+                            Dimension::ALL_DIMENSIONS);
+
+    if (blobs.empty()) {
+      FailStep("the meshes of the scene cannot be read");
+    }
+
+    mLoad = MeshLoad();
+    StartFirstFrameTimer();
+    const Clock::time_point start = Clock::now();
+    std::vector<Geometry> geometries = CreateMeshGeometry(blobs, source);
+    mLoad.loadMs =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    for (Geometry &geometry : geometries) {
+      if (!geometry) {
+        FailStep("the geometry of a mesh cannot be created");
+        continue;
+      }
+      Renderer renderer = Renderer::New(geometry, mShader);
+      Actor actor = Actor::New();
+      actor.SetResizePolicy(ResizePolicy::FILL_TO_PARENT,
+                            Dimension::ALL_DIMENSIONS);
+      actor.AddRenderer(renderer);
+      mMeshes.Add(actor);
+    }
+    mMeshLayer.Add(mMeshes);
+    TimeFirstFrame(mApplication.GetWindow());
+  }
+
+  /**
+   * @brief Keep the measures of a load, and report them once all the loads
+   * of the meshes of the scene from the source are done.
+   */
+  void EndLoad(const std::string &prefix, MeshBlobSource source, int run) {
+    mLoad.firstFrameMs = GetFirstFrameMs();
+    if (mLoad.firstFrameMs < 0.0) {
+      FailStep("the first frame of " + prefix + " has not been presented");
+    }
+    mLoad.peakRssKb = GetPeakRss();
+
+    std::vector<MeshLoad> &loads = mLoads[source];
+    loads.push_back(mLoad);
+    if (run + 1 < LOAD_RUNS) {
+      return;
+    }
+
+    ReportMedian(prefix + ".load", "ms", loads,
+                 [](const MeshLoad &load) { return load.loadMs; });
+    ReportMedian(prefix + ".peak-rss", "kB", loads, [](const MeshLoad &load) {
+      return static_cast<double>(load.peakRssKb);
+    });
+    ReportMedian(prefix + ".first-frame", "ms", loads,
+                 [](const MeshLoad &load) { return load.firstFrameMs; });
+    loads.clear();
+  }
+
+private:
+  Application &mApplication;
+  StepSequencer mSequencer;
+  Shader mShader;
+  Layer mMeshLayer;
+  Actor mMeshes;
+  MeshLoad mLoad;
+  std::vector<MeshLoad> mLoads[std::size(SOURCES)];
+};
+
+DALI_BENCHMARK_TEST(MeshBlobLoadTest, OnInit, 480, 800,
+                    std::size(SCENES) * LOAD_RUNS * std::size(SOURCES),
+                    DEFAULT_STEP_TIMEOUT)
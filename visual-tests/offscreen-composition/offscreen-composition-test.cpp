@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-scene3d/dali-scene3d.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/image-loader/texture-manager.h>
+#include <dali/dali.h>
+#include <dali/devel-api/common/stage-devel.h>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "benchmark-test.h"
+#include "frame-cost-probe.h"
+#include "memory-sampler.h"
+#include "scene-loader.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace {
+// The scene rendered
+const std::string SCENE = "robot.dli";
+
+// The sizes of the scene, from that of the scene3d test to that of the
+// usd-model test
+const struct {
+  int width;
+  int height;
+} RESOLUTIONS[] = {
+    {480, 800},
+    {1280, 720},
+    {1800, 1200},
+};
+
+// The window holds the largest resolution, the scene is centered in it
+const int WINDOW_WIDTH(1800);
+const int WINDOW_HEIGHT(1200);
+
+/**
+ * @brief How the scene reaches the window.
+ */
+enum RenderMode {
+  RENDER_DIRECT,     ///< Rendered by its render task into the window
+  RENDER_COMPOSITED, ///< Rendered into a framebuffer which is drawn flipped
+  RENDER_MODE_COUNT
+};
+
+const char *RENDER_MODE_NAMES[RENDER_MODE_COUNT] = {"direct", "composited"};
+
+// The frames after a setup which are not measured, while its resources are
+// created
+const uint32_t WARMUP_FRAMES = 5u;
+
+// The frames measured
+const uint32_t MEASURED_FRAMES = 120u;
+
+// The frames after a teardown, by which its resources have been released
+const uint32_t TEARDOWN_FRAMES = 3u;
+
+// The maximum time of a step, the largest resolution may render slowly with a
+// software renderer
+const uint32_t RUN_MAX_WAIT = 60000u;
+
+// The deadline of a step for the watchdog, which includes the time the
+// render is set up, before the maximum wait starts
+const uint32_t SETUP_MAX_TIME = 10000u;
+const uint32_t STEP_TIMEOUT =
+    SETUP_MAX_TIME + RUN_MAX_WAIT + STEP_WATCHDOG_MARGIN;
+
+/**
+ * @brief The cost of one mode at one resolution.
+ */
+struct RenderCost {
+  FrameTimeSummary intervals;
+  FrameTimeSummary cpuTimes;
+  double memoryKb = 0.0; ///< The growth of the heap and of the GPU buffers
+};
+
+} // namespace
+
+/**
+ * @brief This benchmark measures the cost of rendering a 3D scene through an
+ * offscreen framebuffer, as the scene3d and usd-model tests do, against
+ * rendering it straight into the window.
+ *
+ * In the composited mode, the scene is rendered by an exclusive render task
+ * into a framebuffer with a colour and a depth texture, whose colour texture
+ * is drawn into the window by a flipped ImageView, an extra full screen pass.
+ * In the direct mode, the same render task renders into a viewport of the
+ * window of the same size.
+ *
+ * The scene is created once, then each mode is set up at each resolution in
+ * its own step, after a step which tears down the previous one, and
+ * MEASURED_FRAMES frames are measured after WARMUP_FRAMES, the probe asking
+ * for every frame. DALi has no GPU timer, so the GPU time is seen in the
+ * frame interval, which includes the wait for the GPU; with a software
+ * renderer it is CPU time as well.
+ *
+ * For each resolution and mode, e.g. "1800x1200.composited", it reports the
+ * percentiles of the frame interval and of the CPU time of the update and
+ * render thread per frame (".interval.p50", ".update-render-cpu.p90"), and
+ * the growth of the heap and of the GPU buffers once set up (".memory"). The
+ * extra cost of the composition over the direct rendering is reported as
+ * e.g. "1800x1200.extra.interval.p50" and "1800x1200.extra.memory".
+ */
+class OffscreenCompositionTest : public BenchmarkTest {
+public:
+  OffscreenCompositionTest(Application &application)
+      : mApplication(application), mSequencer(*this) {}
+
+  void OnInit(Application application) {
+    Dali::Window window = mApplication.GetWindow();
+    window.SetBackgroundColor(Color::WHITE);
+    window.GetRootLayer().SetProperty(Layer::Property::BEHAVIOR,
+                                      Layer::LAYER_3D);
+
+    mSceneCamera = CameraActor::New();
+    mSceneLayer = CreateSceneLayer(window, mSceneCamera);
+
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), mProbe,
+                                 window.GetRootLayer());
+
+    mDecodedScene = DecodeTestSceneAsync(SCENE);
+
+    // The scene is created and its resources uploaded before any measure
+    mSequencer.AddStep("scene")
+        .Do([this]() { CreateScene(); })
+        .WaitForFrames(WARMUP_FRAMES);
+
+    for (const auto &resolution : RESOLUTIONS) {
+      const std::string size = std::to_string(resolution.width) + "x" +
+                               std::to_string(resolution.height);
+      for (int mode = 0; mode < RENDER_MODE_COUNT; ++mode) {
+        const std::string prefix = size + "." + RENDER_MODE_NAMES[mode];
+        mSequencer.AddStep(prefix + "-teardown")
+            .Do([this]() { TearDown(); })
+            .WaitForFrames(TEARDOWN_FRAMES)
+            .Then([this]() { mMemoryBefore = SampleMemory(); });
+        mSequencer.AddStep(prefix)
+            .Do([this, resolution, mode]() {
+              SetUp(resolution.width, resolution.height,
+                    static_cast<RenderMode>(mode));
+            })
+            .WaitForFrames(WARMUP_FRAMES + MEASURED_FRAMES)
+            .MaxWait(RUN_MAX_WAIT)
+            .Then([this, size, mode]() {
+              EndMeasure(size, static_cast<RenderMode>(mode));
+            });
+      }
+    }
+
+    mSequencer.SetFinishedCallback([this]() {
+      DevelStage::RemoveFrameCallback(Stage::GetCurrent(), mProbe);
+      TearDown();
+      Finish(mApplication);
+    });
+    mSequencer.Start(window);
+  }
+
+private:
+  void CreateScene() {
+    mDecoded = mDecodedScene.get();
+    mSceneLayer.Add(CreateTestScene(*mDecoded, mSceneCamera).root);
+  }
+
+  /**
+   * @brief Render the scene at a resolution in a mode, and start measuring
+   * the frames.
+   */
+  void SetUp(int width, int height, RenderMode mode) {
+    Dali::Window window = mApplication.GetWindow();
+    const Vector2 size(width, height);
+    mSceneRender = CreateSceneRenderTask(window, mSceneLayer, mSceneCamera,
+                                         size, mode == RENDER_COMPOSITED);
+
+    if (mode == RENDER_COMPOSITED) {
+      // As the scene3d and usd-model tests
+      mOffscreenImage =
+          CreateSceneImageView(window, mSceneRender, size, &mOffscreenUrl);
+    }
+
+    mProbe.Start(WARMUP_FRAMES, true);
+  }
+
+  /**
+   * @brief Remove the render task and the framebuffer of the previous setup.
+   */
+  void TearDown() {
+    if (mSceneRender) {
+      mApplication.GetWindow().GetRenderTaskList().RemoveTask(mSceneRender);
+      mSceneRender.Reset();
+    }
+    if (mOffscreenImage) {
+      UnparentAndReset(mOffscreenImage);
+      Toolkit::TextureManager::RemoveTexture(mOffscreenUrl);
+      mOffscreenUrl.clear();
+    }
+  }
+
+  /**
+   * @brief Report the cost of a mode at a resolution, and the extra cost of
+   * the composition once both modes have been measured.
+   */
+  void EndMeasure(const std::string &size, RenderMode mode) {
+    mProbe.Stop();
+    const MemorySample memoryAfter = SampleMemory();
+
+    RenderCost &cost = mCosts[mode];
+    cost.intervals = mProbe.GetIntervals();
+    cost.cpuTimes = mProbe.GetCpuTimes();
+    cost.memoryKb = GetGrowthKb(mMemoryBefore.heapKb + mMemoryBefore.gpuKb,
+                                memoryAfter.heapKb + memoryAfter.gpuKb);
+
+    const std::string prefix = size + "." + RENDER_MODE_NAMES[mode];
+    if (cost.intervals.count == 0u) {
+      FailStep("no frame has been measured");
+    }
+    ReportFrameSummary(prefix + ".interval", cost.intervals);
+    ReportFrameSummary(prefix + ".update-render-cpu", cost.cpuTimes);
+    ReportMetric(prefix + ".memory", cost.memoryKb, "kB");
+
+    if (mode + 1 < RENDER_MODE_COUNT) {
+      return;
+    }
+    const RenderCost &direct = mCosts[RENDER_DIRECT];
+    const RenderCost &composited = mCosts[RENDER_COMPOSITED];
+    ReportMetric(size + ".extra.interval.p50",
+                 composited.intervals.p50Ms - direct.intervals.p50Ms, "ms");
+    ReportMetric(size + ".extra.update-render-cpu.p50",
+                 composited.cpuTimes.p50Ms - direct.cpuTimes.p50Ms, "ms");
+    ReportMetric(size + ".extra.memory",
+                 composited.memoryKb - direct.memoryKb, "kB");
+  }
+
+private:
+  Application &mApplication;
+  StepSequencer mSequencer;
+  Layer mSceneLayer;
+  CameraActor mSceneCamera;
+  RenderTask mSceneRender;
+  Toolkit::ImageView mOffscreenImage;
+  std::string mOffscreenUrl;
+  FrameCostProbe mProbe;
+  std::future<std::unique_ptr<DecodedScene>> mDecodedScene;
+  std::unique_ptr<DecodedScene> mDecoded;
+  MemorySample mMemoryBefore;
+  RenderCost mCosts[RENDER_MODE_COUNT];
+};
+
+DALI_BENCHMARK_TEST(OffscreenCompositionTest, OnInit, WINDOW_WIDTH,
+                    WINDOW_HEIGHT,
+                    std::size(RESOLUTIONS) * RENDER_MODE_COUNT * 2 + 1,
+                    STEP_TIMEOUT)
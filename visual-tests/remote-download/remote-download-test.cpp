@@ -36,7 +36,7 @@ using Dali::Integration::ToDaliStringView;
 namespace {
 
 const std::string IMAGE_FILE =
-    TEST_IMAGE_DIR "remote-download/expected-result-1.png";
+    TestImagePath("remote-download/expected-result-1.png");
 const int NUMBER_OF_IMAGES(4);
 struct ImageData {
   std::string url;
@@ -99,7 +99,9 @@ private:
 
   void PostRender(std::string outputFile, bool success) {
     // All steps will have same result.
-    CompareImageFile(IMAGE_FILE, outputFile, 0.98f);
+    if (!CompareImageFile(IMAGE_FILE, outputFile, 0.98f) && RetryCapture()) {
+      return;
+    }
     mApplication.Quit();
   }
 
@@ -33,30 +33,19 @@ using namespace Dali::Toolkit;
 namespace
 {
 
-const char* IMAGE_PATH[] = {
-    TEST_IMAGE_DIR "resource-uploading/initial-image.jpg",
-    TEST_IMAGE_DIR "resource-uploading/large-image-01.png",
-    TEST_IMAGE_DIR "resource-uploading/large-image-02.png",
-    TEST_IMAGE_DIR "resource-uploading/large-image-03.png",
-    TEST_IMAGE_DIR "resource-uploading/large-image-04.png"
+const std::string IMAGE_PATH[] = {
+    TestImagePath("resource-uploading/initial-image.jpg"),
+    TestImagePath("resource-uploading/large-image-01.png"),
+    TestImagePath("resource-uploading/large-image-02.png"),
+    TestImagePath("resource-uploading/large-image-03.png"),
+    TestImagePath("resource-uploading/large-image-04.png")
 };
 
-const std::string FIRST_IMAGE_FILE = TEST_IMAGE_DIR "resource-uploading/expected-result-1.png";
-const std::string SECOND_IMAGE_FILE = TEST_IMAGE_DIR "resource-uploading/expected-result-2.png";
+const std::string FIRST_IMAGE_FILE = TestImagePath("resource-uploading/expected-result-1.png");
+const std::string SECOND_IMAGE_FILE = TestImagePath("resource-uploading/expected-result-2.png");
 
 const unsigned int NUMBER_OF_IMAGES = 2;
 
-enum TestStep
-{
-  SMALL_IMAGES,
-  IMAGE_CHANGE,
-  ADAPTOR_PAUSE,
-  ADAPTOR_RESUME,
-  NUMBER_OF_STEPS
-};
-
-static int gTestStep = -1;
-
 }  // namespace
 
 /**
@@ -70,6 +59,7 @@ class ResourceUploadingTest: public VisualTest
 
   ResourceUploadingTest( Application& application )
     : mApplication( application ),
+      mSequencer( *this ),
       mImageIndex( 0 )
   {
   }
@@ -103,75 +93,36 @@ class ResourceUploadingTest: public VisualTest
       container.Add( mImageViews[x] );
     }
 
-    // Start the test
-    PerformNextTest();
-  }
-
-private:
-
-  void PerformNextTest()
-  {
-    Debug::LogMessage(Debug::INFO, "PerformNextTest()\n");
-    gTestStep++;
-
-    Window window = mApplication.GetWindow();
-
-    switch ( gTestStep )
+    // Each step captures the window as soon as the images are ready
+    auto& smallImages = mSequencer.AddStep( "small-images" );
+    auto& imageChange = mSequencer.AddStep( "image-change" ).Do( [this]() { ChangeImage(); } ); // May take time to upload.
+    auto& adaptorPause = mSequencer.AddStep( "adaptor-pause" ).Do( [this]()
     {
-      case SMALL_IMAGES:
-      {
-        StartDrawTimer();
-        break;
-      }
-      case IMAGE_CHANGE:
-      {
-        // Change the images
-        ChangeImage(); // May take time to upload.
-        StartDrawTimer();
-        break;
-      }
-      case ADAPTOR_PAUSE:
-      {
-        // Pause the adaptor
-        Adaptor::Get().Pause();
-
-        // Change the images in the image view again when adaptor is paused
-        ChangeImage();
-        StartDrawTimer();
-        break;
-      }
-      case ADAPTOR_RESUME:
-      {
-        break;
-      }
-      default:
-        break;
+      // Change the images in the image view again when adaptor is paused
+      Adaptor::Get().Pause();
+      ChangeImage();
+    } );
+    for( unsigned int x = 0; x < NUMBER_OF_IMAGES; x++ )
+    {
+      smallImages.WaitForResourceReady( mImageViews[x] );
+      imageChange.WaitForResourceReady( mImageViews[x] );
+      adaptorPause.WaitForResourceReady( mImageViews[x] );
     }
-  }
+    smallImages.Capture();
+    imageChange.Capture();
 
-  void StartDrawTimer()
-  {
-    Debug::LogMessage(Debug::INFO, "StartDrawTimer()\n");
-    mTimer = Timer::New( 1000 ); // ms
-    mTimer.TickSignal().Connect( this, &ResourceUploadingTest::OnTimer);
-    mTimer.Start();
-  }
+    // We check the content of the window immediately after the adaptor is resumed.
+    // The textures should be uploaded already when the adaptor is paused, so the
+    // rendering of the images should be instant.
+    adaptorPause.MaxWait( 1000 ).Then( []() { Adaptor::Get().Resume(); } ).Capture();
 
-  bool OnTimer()
-  {
-    Debug::LogMessage(Debug::INFO, "OnTimer()\n");
-    if(gTestStep == ADAPTOR_PAUSE)
-    {
-      Adaptor::Get().Resume();
-      gTestStep++;
-      // We check the content of the window immediately after the adaptor is resumed.
-      // The textures should be uploaded already when the adaptor is paused, so the
-      // rendering of the images should be instant.
-    }
-    CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-    return false;
+    mSequencer.SetFinishedCallback( [this]() { mApplication.Quit(); } );
+
+    // Start the test
+    mSequencer.Start( defaultWindow );
   }
 
+private:
 
   void ChangeImage()
   {
@@ -196,24 +147,20 @@ private:
   void PostRender(std::string outputFile, bool success)
   {
     Debug::LogMessage(Debug::INFO, "PostRender(%s, %s)\n", outputFile.c_str(), success?"T":"F");
-    std::string images[] = { FIRST_IMAGE_FILE, SECOND_IMAGE_FILE, SECOND_IMAGE_FILE, SECOND_IMAGE_FILE };
-    CompareImageFile(images[gTestStep], outputFile, 0.98f);
-
-    if ( gTestStep == ADAPTOR_RESUME )
-    {
-      mApplication.Quit();
-    }
-    else
+    std::string images[] = { FIRST_IMAGE_FILE, SECOND_IMAGE_FILE, SECOND_IMAGE_FILE };
+    if(!CompareImageFile(images[mSequencer.GetCurrentStep()], outputFile, 0.98f) && RetryCapture())
     {
-      PerformNextTest();
+      return;
     }
+
+    mSequencer.Next();
   }
 
 private:
   Application&   mApplication;
+  StepSequencer  mSequencer;
   ImageView      mImageViews[NUMBER_OF_IMAGES];
   int            mImageIndex;
-  Timer          mTimer;
 };
 
 DALI_VISUAL_TEST( ResourceUploadingTest, OnInit )
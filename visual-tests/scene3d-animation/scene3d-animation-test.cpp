@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <dali-scene3d/dali-scene3d.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/dali.h>
+#include <dali/devel-api/common/stage-devel.h>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "benchmark-test.h"
+#include "frame-cost-probe.h"
+#include "scene-loader.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace {
+// The animated scenes: exercise.dli is skinned, robot.dli animates the
+// transforms of its nodes
+const std::string SCENES[] = {"exercise.dli", "robot.dli"};
+
+// The numbers of instances of a scene played at the same time, one step each,
+// unless the test is run with --instances, up to MAX_INSTANCES
+const int INSTANCE_COUNTS[] = {1, 10, 100};
+const int MAX_INSTANCES = 100;
+
+// The frames after the instances are created which are not measured, while
+// their resources are uploaded
+const uint32_t WARMUP_FRAMES = 5u;
+
+// The frames measured, at the real speed of the animations
+const uint32_t MEASURED_FRAMES = 120u;
+
+// The maximum time of a step, 100 skinned instances may render slowly with a
+// software renderer
+const uint32_t RUN_MAX_WAIT = 120000u;
+
+// The deadline of a step for the watchdog, which includes the time the
+// instances are created, before the maximum wait starts
+const uint32_t CREATE_MAX_TIME = 60000u;
+const uint32_t STEP_TIMEOUT =
+    CREATE_MAX_TIME + RUN_MAX_WAIT + STEP_WATCHDOG_MARGIN;
+
+const int WINDOW_WIDTH(480);
+const int WINDOW_HEIGHT(800);
+
+} // namespace
+
+/**
+ * @brief This benchmark measures the per-frame cost of the animations of the
+ * DLI scenes: the skinning of exercise.dli and the node animation of
+ * robot.dli.
+ *
+ * Each scene is played as 1, 10 and 100 instances (or the number given by
+ * --instances), each number in its own step. The instances
+ * share the resources of one decoded scene (see CreateTestScene), and are laid
+ * out in a grid. The first animation of every instance is played in a loop
+ * at its real speed, and MEASURED_FRAMES frames are measured after
+ * WARMUP_FRAMES.
+ *
+ * The percentiles of the frame interval and of the CPU time of the update
+ * and render thread per frame are reported as METRIC: lines and in the
+ * results JSON, e.g. "exercise.x10.interval.p50" and
+ * "robot.x100.update-render-cpu.p99".
+ */
+class Scene3DAnimationTest : public BenchmarkTest {
+public:
+  Scene3DAnimationTest(Application &application)
+      : mApplication(application), mSequencer(*this) {}
+
+  void OnInit(Application application) {
+    const std::vector<int> instanceCounts = GetInstanceCounts(
+        {std::begin(INSTANCE_COUNTS), std::end(INSTANCE_COUNTS)},
+        MAX_INSTANCES);
+    if (instanceCounts.empty()) {
+      mApplication.Quit();
+      return;
+    }
+
+    Dali::Window window = mApplication.GetWindow();
+    window.SetBackgroundColor(Color::WHITE);
+    window.GetRootLayer().SetProperty(Layer::Property::BEHAVIOR,
+                                      Layer::LAYER_3D);
+
+    mSceneCamera = CameraActor::New();
+    mSceneLayer = CreateSceneLayer(window, mSceneCamera);
+
+    // The scene is rendered as by the scene3d test, to a framebuffer with a
+    // depth attachment which is then drawn to the window
+    const Vector2 size(WINDOW_WIDTH, WINDOW_HEIGHT);
+    mSceneRender = CreateSceneRenderTask(window, mSceneLayer, mSceneCamera,
+                                         size, true);
+    CreateSceneImageView(window, mSceneRender, size);
+
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), mProbe,
+                                 window.GetRootLayer());
+
+    for (const std::string &scene : SCENES) {
+      mDecodedScenes.push_back(DecodeTestSceneAsync(scene));
+    }
+    mScenes.resize(std::size(SCENES));
+
+    for (size_t index = 0; index < std::size(SCENES); ++index) {
+      const std::string &scene = SCENES[index];
+      const std::string name = scene.substr(0, scene.rfind('.'));
+      for (int count : instanceCounts) {
+        const std::string prefix = name + ".x" + std::to_string(count);
+        mSequencer.AddStep(prefix)
+            .Do([this, index, count]() { Play(index, count); })
+            .WaitForFrames(WARMUP_FRAMES + MEASURED_FRAMES)
+            .MaxWait(RUN_MAX_WAIT)
+            .Then([this, prefix]() { Report(prefix); });
+      }
+    }
+
+    mSequencer.SetFinishedCallback([this]() {
+      DevelStage::RemoveFrameCallback(Stage::GetCurrent(), mProbe);
+      Finish(mApplication);
+    });
+    mSequencer.Start(window);
+  }
+
+private:
+  /**
+   * @brief Play instances of a scene in place of the previous ones.
+   * @param[in] index The index of the scene
+   * @param[in] count The number of instances
+   */
+  void Play(size_t index, int count) {
+    Clear();
+
+    if (!mScenes[index]) {
+      mScenes[index] = mDecodedScenes[index].get();
+    }
+    DecodedScene &decoded = *mScenes[index];
+
+    for (int i = 0; i < count; ++i) {
+      LoadedScene scene = CreateTestScene(decoded, mSceneCamera);
+      if (scene.animations.empty()) {
+        FailStep(decoded.name + " has no animation");
+        return;
+      }
+
+      Actor root = scene.root;
+      SetSceneGridCell(root, i, count);
+      mSceneLayer.Add(root);
+      mInstances.push_back(root);
+
+      Animation animation = scene.animations[0].ReAnimate(
+          [&root](const Scene3D::Loader::AnimatedProperty &property) {
+            return root.FindChildByName(property.mNodeName);
+          });
+      animation.SetLooping(true);
+      animation.Play();
+      mAnimations.push_back(animation);
+    }
+
+    mProbe.Start(WARMUP_FRAMES);
+  }
+
+  /**
+   * @brief Report the cost of the frames measured, and stop the instances.
+   */
+  void Report(const std::string &prefix) {
+    mProbe.Stop();
+
+    const FrameTimeSummary intervals = mProbe.GetIntervals();
+    const FrameTimeSummary cpuTimes = mProbe.GetCpuTimes();
+    if (intervals.count == 0u) {
+      FailStep("no frame has been measured");
+    }
+    ReportFrameSummary(prefix + ".interval", intervals);
+    ReportFrameSummary(prefix + ".update-render-cpu", cpuTimes);
+    Clear();
+  }
+
+  void Clear() {
+    for (Animation &animation : mAnimations) {
+      animation.Stop();
+    }
+    mAnimations.clear();
+    for (Actor &instance : mInstances) {
+      UnparentAndReset(instance);
+    }
+    mInstances.clear();
+  }
+
+private:
+  Application &mApplication;
+  StepSequencer mSequencer;
+  Layer mSceneLayer;
+  CameraActor mSceneCamera;
+  RenderTask mSceneRender;
+  FrameCostProbe mProbe;
+  std::vector<std::future<std::unique_ptr<DecodedScene>>> mDecodedScenes;
+  std::vector<std::unique_ptr<DecodedScene>> mScenes;
+  std::vector<Actor> mInstances;
+  std::vector<Animation> mAnimations;
+};
+
+DALI_BENCHMARK_TEST(Scene3DAnimationTest, OnInit, WINDOW_WIDTH, WINDOW_HEIGHT,
+                    std::size(SCENES) * std::size(INSTANCE_COUNTS),
+                    STEP_TIMEOUT)
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <dali-scene3d/dali-scene3d.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/dali.h>
+#include <dali/devel-api/common/stage-devel.h>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "benchmark-test.h"
+#include "frame-cost-probe.h"
+#include "memory-sampler.h"
+#include "scene-loader.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace {
+// The scene instantiated, and the prefix of the measures
+const std::string SCENE = "robot.dli";
+const std::string NAME = "robot";
+
+// The numbers of instances of the scene, one step each, unless the test is
+// run with --instances, up to MAX_INSTANCES
+const int INSTANCE_COUNTS[] = {1, 10, 100, 1000};
+const int MAX_INSTANCES = 1000;
+
+// The frames after the instances are created which are not measured, while
+// their render items are prepared
+const uint32_t WARMUP_FRAMES = 5u;
+
+// The frames measured
+const uint32_t MEASURED_FRAMES = 60u;
+
+// The maximum time of a step, 1000 instances may render slowly with a software
+// renderer
+const uint32_t RUN_MAX_WAIT = 120000u;
+
+// The deadline of a step for the watchdog, which includes the time the
+// instances are created, before the maximum wait starts
+const uint32_t CREATE_MAX_TIME = 60000u;
+const uint32_t STEP_TIMEOUT =
+    CREATE_MAX_TIME + RUN_MAX_WAIT + STEP_WATCHDOG_MARGIN;
+
+const int WINDOW_WIDTH(480);
+const int WINDOW_HEIGHT(800);
+
+using Clock = std::chrono::steady_clock;
+
+double Milliseconds(Clock::duration duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+} // namespace
+
+/**
+ * @brief This benchmark measures how the instances of one scene scale: the
+ * creation of their nodes, their memory and the cost of their frames.
+ *
+ * robot.dli is decoded once, and its resources are created with a first
+ * instance, reported as "robot.first-instance" (see CreateTestScene). Each
+ * step then creates 1, 10, 100 and 1000 instances of it (or the number given
+ * by --instances), which all share the same ResourceBundle and its reference
+ * counts, laid out in a grid (see SetSceneGridCell). The
+ * instances are rendered for MEASURED_FRAMES frames after WARMUP_FRAMES, the
+ * probe asking for every frame since nothing moves.
+ *
+ * For each number of instances, e.g. "robot.x1000", it reports the time to
+ * create them (".create") and per instance (".create-per-instance"), the
+ * growth of the resident set size and of the heap per instance once rendered
+ * (".rss-per-instance" and ".heap-per-instance") and the percentiles of the
+ * frame interval and of the CPU time of the update and render thread per
+ * frame (".interval.p50" and ".update-render-cpu.p99").
+ */
+class Scene3DInstancingTest : public BenchmarkTest {
+public:
+  Scene3DInstancingTest(Application &application)
+      : mApplication(application), mSequencer(*this) {}
+
+  void OnInit(Application application) {
+    const std::vector<int> instanceCounts = GetInstanceCounts(
+        {std::begin(INSTANCE_COUNTS), std::end(INSTANCE_COUNTS)},
+        MAX_INSTANCES);
+    if (instanceCounts.empty()) {
+      mApplication.Quit();
+      return;
+    }
+
+    Dali::Window window = mApplication.GetWindow();
+    window.SetBackgroundColor(Color::WHITE);
+    window.GetRootLayer().SetProperty(Layer::Property::BEHAVIOR,
+                                      Layer::LAYER_3D);
+
+    // The scene is rendered as by the scene3d test, to a framebuffer with a
+    // depth attachment which is then drawn to the window
+    mSceneCamera = CameraActor::New();
+    mSceneLayer = CreateSceneLayer(window, mSceneCamera);
+    const Vector2 size(WINDOW_WIDTH, WINDOW_HEIGHT);
+    mSceneRender = CreateSceneRenderTask(window, mSceneLayer, mSceneCamera,
+                                         size, true);
+    CreateSceneImageView(window, mSceneRender, size);
+
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), mProbe,
+                                 window.GetRootLayer());
+
+    mDecodedScene = DecodeTestSceneAsync(SCENE);
+
+    // The resources are created and uploaded once, before the instances are
+    // measured
+    mSequencer.AddStep(NAME + ".first-instance")
+        .Do([this]() { CreateFirstInstance(); })
+        .WaitForFrames(WARMUP_FRAMES)
+        .Then([this]() { Clear(); });
+
+    for (int count : instanceCounts) {
+      const std::string prefix = NAME + ".x" + std::to_string(count);
+      mSequencer.AddStep(prefix)
+          .Do([this, count]() { CreateInstances(count); })
+          .WaitForFrames(WARMUP_FRAMES + MEASURED_FRAMES)
+          .MaxWait(RUN_MAX_WAIT)
+          .Then([this, prefix, count]() { Report(prefix, count); });
+    }
+
+    mSequencer.SetFinishedCallback([this]() {
+      DevelStage::RemoveFrameCallback(Stage::GetCurrent(), mProbe);
+      Finish(mApplication);
+    });
+    mSequencer.Start(window);
+  }
+
+private:
+  void CreateFirstInstance() {
+    mScene = mDecodedScene.get();
+
+    const Clock::time_point start = Clock::now();
+    LoadedScene scene = CreateTestScene(*mScene, mSceneCamera);
+    ReportMetric(NAME + ".first-instance", Milliseconds(Clock::now() - start),
+                 "ms");
+
+    mSceneLayer.Add(scene.root);
+    mInstances.push_back(scene.root);
+  }
+
+  /**
+   * @brief Create instances of the scene in place of the previous ones, and
+   * start measuring their frames.
+   * @param[in] count The number of instances
+   */
+  void CreateInstances(int count) {
+    Clear();
+    mMemoryBefore = SampleMemory();
+
+    const Clock::time_point start = Clock::now();
+    for (int i = 0; i < count; ++i) {
+      Actor root = CreateTestScene(*mScene, mSceneCamera).root;
+      SetSceneGridCell(root, i, count);
+      mSceneLayer.Add(root);
+      mInstances.push_back(root);
+    }
+    mCreateMs = Milliseconds(Clock::now() - start);
+
+    mProbe.Start(WARMUP_FRAMES, true);
+  }
+
+  /**
+   * @brief Report the cost of the instances, and remove them.
+   */
+  void Report(const std::string &prefix, int count) {
+    mProbe.Stop();
+    const MemorySample memoryAfter = SampleMemory();
+
+    ReportMetric(prefix + ".create", mCreateMs, "ms");
+    ReportMetric(prefix + ".create-per-instance", mCreateMs / count, "ms");
+    ReportMetric(prefix + ".rss-per-instance",
+                 GetGrowthKb(mMemoryBefore.rssKb, memoryAfter.rssKb) / count,
+                 "kB");
+    ReportMetric(prefix + ".heap-per-instance",
+                 GetGrowthKb(mMemoryBefore.heapKb, memoryAfter.heapKb) / count,
+                 "kB");
+
+    const FrameTimeSummary intervals = mProbe.GetIntervals();
+    if (intervals.count == 0u) {
+      FailStep("no frame has been measured");
+    }
+    ReportFrameSummary(prefix + ".interval", intervals);
+    ReportFrameSummary(prefix + ".update-render-cpu", mProbe.GetCpuTimes());
+    Clear();
+  }
+
+  void Clear() {
+    for (Actor &instance : mInstances) {
+      UnparentAndReset(instance);
+    }
+    mInstances.clear();
+  }
+
+private:
+  Application &mApplication;
+  StepSequencer mSequencer;
+  Layer mSceneLayer;
+  CameraActor mSceneCamera;
+  RenderTask mSceneRender;
+  FrameCostProbe mProbe;
+  std::future<std::unique_ptr<DecodedScene>> mDecodedScene;
+  std::unique_ptr<DecodedScene> mScene;
+  std::vector<Actor> mInstances;
+  MemorySample mMemoryBefore;
+  double mCreateMs = 0.0;
+};
+
+DALI_BENCHMARK_TEST(Scene3DInstancingTest, OnInit, WINDOW_WIDTH, WINDOW_HEIGHT,
+                    std::size(INSTANCE_COUNTS) + 1, STEP_TIMEOUT)
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/dali.h>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "benchmark-test.h"
+#include "perf-statistics.h"
+#include "scene-loader.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace {
+// The scenes loaded, the largest DLI assets of the test scenes
+const std::string SCENES[] = {"exercise.dli", "robot.dli"};
+
+// The number of loads of each scene, the first one is cold and the others
+// warm, then the warm ones again from the original JSON
+const int LOAD_RUNS = 5;
+
+// The frames updated after a load, by which the first one has been presented
+const uint32_t FIRST_FRAME_WAIT = 3u;
+
+const int WINDOW_WIDTH(480);
+const int WINDOW_HEIGHT(800);
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief How all the scenes are loaded together.
+ */
+enum LoadAllMode {
+  LOAD_ALL_LEGACY,   ///< With LoadTestScene, one after the other
+  LOAD_ALL_SERIAL,   ///< Decoded then created, one after the other
+  LOAD_ALL_PARALLEL, ///< Decoded in parallel on the workers, then created
+  LOAD_ALL_MODE_COUNT
+};
+
+/**
+ * @brief The measures of one load of a scene.
+ */
+struct LoadRun {
+  SceneLoadProfile profile;
+  double firstFrameMs = -1.0; ///< From the start of the load, -1 if missing
+};
+
+} // namespace
+
+/**
+ * @brief This benchmark measures the loading of the DLI scenes with
+ * Scene3D::Loader, stage by stage (see SceneLoadStage).
+ *
+ * Each scene is loaded LOAD_RUNS times, each load in its own step. The first
+ * load of a scene is cold: its shaders are compiled and its files read for
+ * the first time in the process. The other loads are warm, and their median
+ * is reported. For each stage, the time and the number of allocations on the
+ * event thread are reported, as well as the time of the whole load, the peak
+ * resident set size of the step and the time from the start of the load to
+ * the first frame presented with the scene, which includes the upload of its
+ * textures and meshes.
+ *
+ * Then all the scenes are loaded together. The serial loads decode each scene
+ * and create it (DecodeTestScene and CreateTestScene) one after the other on
+ * the event thread, and the parallel ones decode them on the workers of the
+ * loader (DecodeTestSceneAsync) while the event thread creates them, so the
+ * speedup of the parallel loads only comes from the parallelism. The loads
+ * with LoadTestScene, which load the resources of each scene twice and do not
+ * share its environment maps, are reported apart as "all.legacy".
+ *
+ * The measures are reported as METRIC: lines and in the results JSON, e.g.
+ * "exercise.cold.load-resources", "exercise.warm.load-resources.allocs" and
+ * "all.speedup".
+ */
+class Scene3DLoadTest : public BenchmarkTest {
+public:
+  Scene3DLoadTest(Application &application)
+      : mApplication(application), mSequencer(*this) {}
+
+  void OnInit(Application application) {
+    Dali::Window window = mApplication.GetWindow();
+    window.SetBackgroundColor(Color::WHITE);
+    window.GetRootLayer().SetProperty(Layer::Property::BEHAVIOR,
+                                      Layer::LAYER_3D);
+
+    mSceneCamera = CameraActor::New();
+    mSceneLayer = CreateSceneLayer(window, mSceneCamera);
+
+    // The scene is rendered as by the scene3d test, to a framebuffer with a
+    // depth attachment which is then drawn to the window
+    const Vector2 size(WINDOW_WIDTH, WINDOW_HEIGHT);
+    mSceneRender = CreateSceneRenderTask(window, mSceneLayer, mSceneCamera,
+                                         size, true);
+    CreateSceneImageView(window, mSceneRender, size);
+
+    for (const std::string &scene : SCENES) {
+      const std::string name = scene.substr(0, scene.rfind('.'));
+      for (int run = 0; run < LOAD_RUNS; ++run) {
+        const std::string step =
+            run == 0 ? name + ".cold" : name + ".warm-" + std::to_string(run);
+        mSequencer.AddStep(step)
+            .Do([this, scene]() { Load(scene); })
+            .WaitForFrames(FIRST_FRAME_WAIT)
+            .Then([this, name, run]() { EndLoad(name, run); });
+      }
+    }
+
+    // Then all the scenes, serially on the event thread or decoded in
+    // parallel on the workers of the loader
+    for (int run = 0; run < LOAD_RUNS; ++run) {
+      mSequencer.AddStep("all.legacy-" + std::to_string(run))
+          .Do([this]() { LoadAll(LOAD_ALL_LEGACY); })
+          .WaitForFrames(FIRST_FRAME_WAIT);
+      mSequencer.AddStep("all.serial-" + std::to_string(run))
+          .Do([this]() { LoadAll(LOAD_ALL_SERIAL); })
+          .WaitForFrames(FIRST_FRAME_WAIT);
+      mSequencer.AddStep("all.parallel-" + std::to_string(run))
+          .Do([this]() { LoadAll(LOAD_ALL_PARALLEL); })
+          .WaitForFrames(FIRST_FRAME_WAIT);
+    }
+    mSequencer.AddStep("all.speedup").Do([this]() { ReportSpeedup(); });
+
+    mSequencer.SetFinishedCallback([this]() { Finish(mApplication); });
+    mSequencer.Start(window);
+  }
+
+private:
+  /**
+   * @brief Load a scene in place of the previous one, and ask for the time
+   * at which the first frame with it is presented.
+   */
+  void Load(const std::string &scene) {
+    UnparentAndReset(mScene);
+
+    mRun = LoadRun();
+    StartFirstFrameTimer();
+    mScene = LoadTestScene(scene, mSceneCamera, &mRun.profile).root;
+    mSceneLayer.Add(mScene);
+    TimeFirstFrame(mApplication.GetWindow());
+  }
+
+  /**
+   * @brief Load all the scenes in place of the previous ones, and keep the
+   * time taken.
+   * @param[in] mode How the scenes are loaded
+   */
+  void LoadAll(LoadAllMode mode) {
+    UnparentAndReset(mScene);
+    mScene = Actor::New();
+
+    const Clock::time_point start = Clock::now();
+    if (mode == LOAD_ALL_PARALLEL) {
+      std::vector<std::future<std::unique_ptr<DecodedScene>>> decodedScenes;
+      for (const std::string &scene : SCENES) {
+        decodedScenes.push_back(DecodeTestSceneAsync(scene));
+      }
+      for (auto &decodedScene : decodedScenes) {
+        std::unique_ptr<DecodedScene> decoded = decodedScene.get();
+        mScene.Add(CreateTestScene(*decoded, mSceneCamera).root);
+      }
+    } else if (mode == LOAD_ALL_SERIAL) {
+      for (const std::string &scene : SCENES) {
+        std::unique_ptr<DecodedScene> decoded = DecodeTestScene(scene);
+        mScene.Add(CreateTestScene(*decoded, mSceneCamera).root);
+      }
+    } else {
+      for (const std::string &scene : SCENES) {
+        mScene.Add(LoadTestScene(scene, mSceneCamera).root);
+      }
+    }
+    const double milliseconds =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    mLoadAllMs[mode].push_back(milliseconds);
+
+    mSceneLayer.Add(mScene);
+  }
+
+  /**
+   * @brief Report the time of the loads of all the scenes, and how much
+   * faster the parallel ones are than the serial ones.
+   */
+  void ReportSpeedup() {
+    const double legacyMs =
+        ComputeStatistics(mLoadAllMs[LOAD_ALL_LEGACY]).median;
+    const double serialMs =
+        ComputeStatistics(mLoadAllMs[LOAD_ALL_SERIAL]).median;
+    const double parallelMs =
+        ComputeStatistics(mLoadAllMs[LOAD_ALL_PARALLEL]).median;
+    ReportMetric("all.legacy", legacyMs, "ms");
+    ReportMetric("all.serial", serialMs, "ms");
+    ReportMetric("all.parallel", parallelMs, "ms");
+    if (parallelMs > 0.0) {
+      ReportMetric("all.speedup", serialMs / parallelMs, "x");
+    }
+  }
+
+  /**
+   * @brief Keep the measures of a load, and report them once all the loads
+   * of the scene are done.
+   */
+  void EndLoad(const std::string &name, int run) {
+    mRun.firstFrameMs = GetFirstFrameMs();
+    if (mRun.firstFrameMs < 0.0) {
+      FailStep("the first frame of " + name + " has not been presented");
+    }
+    if (run == 0) {
+      Report(name + ".cold", {mRun});
+      mWarmRuns.clear();
+    } else {
+      mWarmRuns.push_back(mRun);
+    }
+    if (run + 1 == LOAD_RUNS && !mWarmRuns.empty()) {
+      Report(name + ".warm", mWarmRuns);
+    }
+  }
+
+  /**
+   * @brief Report the median of each measure of the given loads.
+   */
+  void Report(const std::string &prefix, const std::vector<LoadRun> &runs) {
+    for (int stage = 0; stage < SCENE_LOAD_STAGE_COUNT; ++stage) {
+      const std::string name =
+          prefix + "." +
+          GetSceneLoadStageName(static_cast<SceneLoadStage>(stage));
+      ReportMedian(name, "ms", runs, [stage](const LoadRun &run) {
+        return run.profile.stageMs[stage];
+      });
+      ReportMedian(name + ".allocs", "count", runs,
+                   [stage](const LoadRun &run) {
+                     return static_cast<double>(run.profile.allocations[stage]);
+                   });
+    }
+    ReportMedian(prefix + ".total", "ms", runs,
+                 [](const LoadRun &run) { return run.profile.totalMs; });
+    ReportMedian(prefix + ".peak-rss", "kB", runs, [](const LoadRun &run) {
+      return static_cast<double>(run.profile.peakRssKb);
+    });
+    ReportMedian(prefix + ".first-frame", "ms", runs,
+                 [](const LoadRun &run) { return run.firstFrameMs; });
+  }
+
+private:
+  Application &mApplication;
+  StepSequencer mSequencer;
+  Layer mSceneLayer;
+  CameraActor mSceneCamera;
+  RenderTask mSceneRender;
+  Actor mScene;
+  LoadRun mRun;
+  std::vector<LoadRun> mWarmRuns;
+  std::vector<double> mLoadAllMs[LOAD_ALL_MODE_COUNT];
+};
+
+DALI_BENCHMARK_TEST(Scene3DLoadTest, OnInit, WINDOW_WIDTH, WINDOW_HEIGHT,
+                    std::size(SCENES) * LOAD_RUNS + 3 * LOAD_RUNS + 1,
+                    DEFAULT_STEP_TIMEOUT)
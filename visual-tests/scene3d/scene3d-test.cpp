@@ -19,55 +19,42 @@
 #include <cstdio>
 #include <dali-scene3d/dali-scene3d.h>
 #include <dali-toolkit/dali-toolkit.h>
-#include <dali-toolkit/devel-api/image-loader/texture-manager.h>
 #include <dali/dali.h>
-#include <dali/devel-api/rendering/frame-buffer-devel.h>
 #include <dali/integration-api/debug.h>
-#include <dali/integration-api/string-utils.h>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <vector>
 
 // INTERNAL INCLUDES
+#include "scene-loader.h"
+#include "scene-prefetcher.h"
 #include "visual-test.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
 using namespace Dali::Scene3D::Loader;
 
-using Dali::Integration::ToDaliString;
-
 namespace {
 
-const Vector3 CAMERA_DEFAULT_POSITION(0.0f, 0.0f, 3.5f);
-
-const std::string RESOURCE_TYPE_DIRS[]{
-    TEST_SCENE_DIR "environments/",
-    TEST_SCENE_DIR "shaders/",
-    TEST_SCENE_DIR "models/",
-    TEST_SCENE_DIR "images/",
-};
+// The scenes of the steps, each decoded while the previous step runs
+const std::vector<std::string> SCENES = {"exercise.dli", "robot.dli"};
 
 const std::string FIRST_IMAGE_FILE =
-    TEST_IMAGE_DIR "scene3d/expected-result-1.png";
+    TestImagePath("scene3d/expected-result-1.png");
 const std::string SECOND_IMAGE_FILE =
-    TEST_IMAGE_DIR "scene3d/expected-result-2.png";
+    TestImagePath("scene3d/expected-result-2.png");
 const std::string THIRD_IMAGE_FILE =
-    TEST_IMAGE_DIR "scene3d/expected-result-3.png";
+    TestImagePath("scene3d/expected-result-3.png");
 const std::string FOURTH_IMAGE_FILE =
-    TEST_IMAGE_DIR "scene3d/expected-result-4.png";
+    TestImagePath("scene3d/expected-result-4.png");
+
+const std::string IMAGE_FILES[] = {FIRST_IMAGE_FILE, SECOND_IMAGE_FILE,
+                                   THIRD_IMAGE_FILE, FOURTH_IMAGE_FILE};
 
 const int WINDOW_WIDTH(480);
 const int WINDOW_HEIGHT(800);
 
-enum TestStep {
-  LOAD_FIRST_SCENE,
-  FIRST_SCENE_ANIMATION,
-  LOAD_SECOND_SCENE,
-  SECOND_SCENE_ANIMATION,
-  NUMBER_OF_STEPS
-};
-
-static int gTestStep = -1;
-
 } // namespace
 
 /**
@@ -86,7 +73,8 @@ static int gTestStep = -1;
  */
 class Scene3DTest : public VisualTest {
 public:
-  Scene3DTest(Application &application) : mApplication(application) {}
+  Scene3DTest(Application &application)
+      : mApplication(application), mSequencer(*this) {}
 
   void OnInit(Application application) {
     Dali::Window window = mApplication.GetWindow();
@@ -94,189 +82,82 @@ public:
     window.GetRootLayer().SetProperty(Layer::Property::BEHAVIOR,
                                       Layer::LAYER_3D);
 
-    // Create a custom layer for rendering a 3D scene (depth testing is enabled
+    // Create a custom camera (will be modified by Scene3d::Loader, below), in
+    // a custom layer for rendering a 3D scene (depth testing is enabled
     // automatically)
-    mSceneLayer = Layer::New();
-    mSceneLayer.SetProperty(Actor::Property::PARENT_ORIGIN,
-                            ParentOrigin::CENTER);
-    mSceneLayer.SetProperty(Actor::Property::PIVOT, Pivot::CENTER);
-    mSceneLayer.SetResizePolicy(ResizePolicy::FILL_TO_PARENT,
-                                Dimension::ALL_DIMENSIONS);
-    mSceneLayer[Layer::Property::BEHAVIOR] = Layer::LAYER_3D;
-    window.Add(mSceneLayer);
-
-    // Create a custom camera (will be modified by Scene3d::Loader, below)
     mSceneCamera = CameraActor::New();
-    mSceneLayer.Add(mSceneCamera);
+    mSceneLayer = CreateSceneLayer(window, mSceneCamera);
 
     // Create a custom render task that _exclusively_ renders to a framebuffer
-    // with a depth attachment.
-    auto renderTasks = window.GetRenderTaskList();
-    mSceneRender = renderTasks.CreateTask();
-    mSceneRender.SetCameraActor(mSceneCamera);
-    mSceneRender.SetSourceActor(mSceneLayer);
-    mSceneRender.SetClearColor(Color::WHITE);
-    mSceneRender.SetClearEnabled(true);
-    mSceneRender.SetRefreshRate(RenderTask::REFRESH_ALWAYS);
-    mSceneRender.SetExclusive(true);
-
-    mSceneFBO = FrameBuffer::New(WINDOW_WIDTH, WINDOW_HEIGHT,
-                                 FrameBuffer::Attachment::COLOR_DEPTH);
-    Texture depthTexture =
-        Texture::New(TextureType::TEXTURE_2D, Pixel::DEPTH_FLOAT, WINDOW_WIDTH,
-                     WINDOW_HEIGHT);
-    DevelFrameBuffer::AttachDepthTexture(mSceneFBO, depthTexture);
-    mSceneRender.SetFrameBuffer(mSceneFBO);
-
-    // Now render the color attachment to the main tree, but because fbo is
-    // "upside-down" compared to loaded images we need to invert the image.
-    auto offscreen = mSceneFBO.GetColorTexture();
-    auto offscreenUrl = Toolkit::TextureManager::AddTexture(offscreen);
-    auto offscreenImage = Toolkit::ImageView::New(offscreenUrl);
-    offscreenImage[Actor::Property::PARENT_ORIGIN] = ParentOrigin::CENTER;
-    offscreenImage[Actor::Property::PIVOT] = Pivot::CENTER;
-    offscreenImage.SetResizePolicy(ResizePolicy::FILL_TO_PARENT,
-                                   Dimension::ALL_DIMENSIONS);
-    offscreenImage[Actor::Property::SCALE_Y] = -1; // Invert the image.
-    window.Add(offscreenImage);
-
-    // Start the test
-    PrepareNextTest();
-  }
-
-private:
-  void PrepareNextTest() {
-    gTestStep++;
-    switch (gTestStep) {
-    case LOAD_FIRST_SCENE: {
-      mScene = LoadScene("exercise.dli", mSceneCamera);
-      mSceneLayer.Add(mScene);
-
-      CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-      break;
-    }
-    case FIRST_SCENE_ANIMATION: {
-      if (mAnimation) {
-        mAnimation.Play();
-      } else {
-        CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-      }
-      break;
-    }
-    case LOAD_SECOND_SCENE: {
-      UnparentAndReset(mScene);
-      mScene = LoadScene("robot.dli", mSceneCamera);
-      mSceneLayer.Add(mScene);
-      CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-      break;
+    // with a depth attachment, whose color attachment is then rendered to the
+    // main tree
+    const Vector2 size(WINDOW_WIDTH, WINDOW_HEIGHT);
+    mSceneRender = CreateSceneRenderTask(window, mSceneLayer, mSceneCamera,
+                                         size, true);
+    CreateSceneImageView(window, mSceneRender, size);
+
+    // The first scene is created as soon as it has been decoded, while the
+    // second one is still being decoded
+    mPrefetcher = std::make_unique<ScenePrefetcher>(SCENES);
+
+    // Each scene is captured once loaded, then at the end of its animation,
+    // if it has one
+    for (const std::string &scene : SCENES) {
+      const std::string name = scene.substr(0, scene.rfind('.'));
+      mSequencer.AddStep(name)
+          .Do([this]() {
+            UnparentAndReset(mScene);
+            mScene = LoadScene(mSceneCamera);
+            mSceneLayer.Add(mScene);
+          })
+          .Capture();
+      mSequencer.AddStep(name + "-animation")
+          .Do([this]() {
+            if (mAnimation) {
+              mSequencer.GetClock().PlayToEnd(mAnimation);
+            }
+          })
+          .WaitForAnimation([this]() { return mAnimation; })
+          .Capture();
     }
-    case SECOND_SCENE_ANIMATION: {
-      if (mAnimation) {
-        mAnimation.Play();
-      } else {
-        CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-      }
-      break;
-    }
-    default:
-      break;
-    }
-  }
 
-  void OnFinishedAnimation(Animation animation) {
-    CaptureWindowAfterFrameRendered(mApplication.GetWindow());
+    mSequencer.SetFinishedCallback([this]() {
+      const ScenePrefetchStats &prefetch = mPrefetcher->GetStats();
+      ReportMetric("scene-prefetch.saved", prefetch.savedMs, "ms");
+      ReportMetric("scene-prefetch.wait", prefetch.waitMs, "ms");
+      mApplication.Quit();
+    });
+    mSequencer.Start(window);
   }
 
+private:
   void PostRender(std::string outputFile, bool success) {
-    const std::string images[] = {FIRST_IMAGE_FILE, SECOND_IMAGE_FILE,
-                                  THIRD_IMAGE_FILE, FOURTH_IMAGE_FILE};
-
-    CompareImageFile(images[gTestStep], outputFile, 0.98f);
-
-    if (gTestStep + 1 < NUMBER_OF_STEPS) {
-      PrepareNextTest();
-    } else {
-      mApplication.Quit();
+    if (!CompareImageFile(IMAGE_FILES[mSequencer.GetCurrentStep()],
+                          outputFile, 0.98f) &&
+        RetryCapture()) {
+      return;
     }
+    mSequencer.Next();
   }
 
-  Actor LoadScene(std::string sceneName, CameraActor camera) {
-    ResourceBundle::PathProvider pathProvider = [](ResourceType::Value type) {
-      return RESOURCE_TYPE_DIRS[type];
-    };
-
-    auto sceneFile = pathProvider(ResourceType::Mesh) + sceneName;
-
-    ResourceBundle resources;
-    SceneDefinition scene;
-    SceneMetadata metaData;
-    std::vector<AnimationGroupDefinition> animGroups;
-    std::vector<CameraParameters> cameraParameters;
-    std::vector<LightParameters> lights;
-    std::vector<AnimationDefinition> animations;
-
-    LoadResult output{resources,        scene, metaData, animations, animGroups,
-                      cameraParameters, lights};
-
-    Dali::Scene3D::Loader::ModelLoader modelLoader(
-        ToDaliString(sceneFile),
-        ToDaliString(pathProvider(ResourceType::Mesh) + "/"), output);
-    modelLoader.LoadModel(pathProvider);
-
-    if (cameraParameters.empty()) {
-      cameraParameters.push_back(CameraParameters());
-      cameraParameters[0].matrix.SetTranslation(CAMERA_DEFAULT_POSITION);
-    }
-
-    cameraParameters[0].ConfigureCamera(camera);
-    SetActorCentered(camera);
+  Actor LoadScene(CameraActor camera) {
+    std::unique_ptr<DecodedScene> decoded = mPrefetcher->TakeNext();
+    LoadedScene scene = CreateTestScene(*decoded, camera);
+    Actor sceneRoot = scene.root;
 
-    ViewProjection viewProjection = cameraParameters[0].GetViewProjection();
-    Transforms xforms{MatrixStack{}, viewProjection};
-    Scene3D::Loader::ShaderManagerPtr shaderManager =
-        new Scene3D::Loader::ShaderManager();
-    NodeDefinition::CreateParams nodeParams{resources, xforms, shaderManager,
-                                            {},        {},     {}};
-    Customization::Choices choices;
-
-    Actor sceneRoot = Actor::New();
-    SetActorCentered(sceneRoot);
-
-    for (auto root : scene.GetRoots()) {
-      auto resourceRefs = resources.CreateRefCounter();
-      scene.CountResourceRefs(root, choices, resourceRefs);
-      resources.mReferenceCounts = std::move(resourceRefs);
-      resources.CountEnvironmentReferences();
-      resources.LoadResources(pathProvider);
-
-      if (auto actor = scene.CreateNodes(root, choices, nodeParams)) {
-        scene.ConfigureSkinningShaders(resources, actor,
-                                       std::move(nodeParams.mSkinnables));
-
-        DALI_ASSERT_ALWAYS(scene.ConfigureBlendshapeShaders(
-            resources, actor, std::move(nodeParams.mBlendshapeRequests)));
-
-        scene.ApplyConstraints(actor, std::move(nodeParams.mConstrainables));
-
-        sceneRoot.Add(actor);
-      }
-    }
-
-    if (!animations.empty()) {
+    if (!scene.animations.empty()) {
       auto getActor =
           [&sceneRoot](const Scene3D::Loader::AnimatedProperty &property) {
             return sceneRoot.FindChildByName(property.mNodeName);
           };
 
-      mAnimation = animations[0].ReAnimate(getActor);
+      mAnimation = scene.animations[0].ReAnimate(getActor);
       mAnimation.SetLooping(false);
 
-      // Set speed to be x100
-      mAnimation.SetSpeedFactor(100.0f);
-
-      // Wait until all animations are finished.
-      mAnimation.FinishedSignal().Connect(this,
-                                          &Scene3DTest::OnFinishedAnimation);
+      // Set speed to be x100, the virtual clock does not need to wait at all
+      if (!VirtualClock::IsEnabled()) {
+        mAnimation.SetSpeedFactor(100.0f);
+      }
     } else {
       mAnimation.Reset();
     }
@@ -286,13 +167,14 @@ private:
 
 private:
   Application &mApplication;
+  StepSequencer mSequencer;
   CameraActor mSceneCamera;
   Actor mScene;
   Layer mSceneLayer;
   RenderTask mSceneRender;
-  FrameBuffer mSceneFBO;
   Animation mAnimation;
+  std::unique_ptr<ScenePrefetcher> mPrefetcher;
 };
 
-DALI_VISUAL_TEST_WITH_WINDOW_SIZE(Scene3DTest, OnInit, WINDOW_WIDTH,
-                                  WINDOW_HEIGHT)
+DALI_VISUAL_TEST_WITH_STEPS(Scene3DTest, OnInit, WINDOW_WIDTH, WINDOW_HEIGHT,
+                            std::size(IMAGE_FILES), DEFAULT_STEP_TIMEOUT)
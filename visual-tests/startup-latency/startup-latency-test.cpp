@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/dali.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "benchmark-test.h"
+
+extern char **environ;
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace {
+const std::string IMAGE_FILE =
+    TestResourcesPath("startup-latency/startup-image.png");
+
+// The environment variable with the file to which a warm launch writes its
+// phases, which also tells the process that it is the warm launch
+const char *STARTUP_REPORT_ENV = "DALI_STARTUP_REPORT";
+
+// The phases reported, the process start is the origin of the others
+const StartupPhase REPORTED_PHASES[] = {
+    STARTUP_MAIN,         STARTUP_APPLICATION_NEW, STARTUP_INIT_SIGNAL,
+    STARTUP_FIRST_UPDATE, STARTUP_FIRST_FRAME,     STARTUP_CONTROL_READY};
+
+// The maximum time a launch waits for its controls in milliseconds
+const uint32_t LAUNCH_MAX_WAIT = 30000u;
+
+// The maximum time the cold launch waits for the warm one to exit
+const uint32_t WARM_LAUNCH_MAX_WAIT = 50000u;
+
+} // namespace
+
+/**
+ * @brief This benchmark measures the startup latency of a DALi application.
+ *
+ * The test is launched twice: the first launch (cold) measures itself, then
+ * launches the same executable again (warm) with the same options, once the
+ * libraries, the fonts and the image are in the page cache and the GPU driver
+ * has been initialised once. The cold launch keeps processing its events
+ * while it waits for the warm one to exit. Each launch reports the time from
+ * the start of its process to each phase of the startup (see StartupPhase):
+ * main (the dynamic libraries are loaded), Application::New, the InitSignal,
+ * the first update, the first frame presented and the first controls ready, a
+ * TextLabel (font initialisation) and an ImageView (image decoding and
+ * upload).
+ *
+ * The phases are reported as METRIC: lines and in the results JSON, e.g.
+ * "cold.first-frame" and "warm.first-frame". Whether the cold launch is really
+ * cold depends on the state of the machine, e.g. after dropping the caches.
+ */
+class StartupLatencyTest : public BenchmarkTest {
+public:
+  StartupLatencyTest(Application &application)
+      : mApplication(application), mSequencer(*this),
+        mWarmLaunch(getenv(STARTUP_REPORT_ENV) != nullptr) {}
+
+  void OnInit(Application application) {
+    Dali::Window window = mApplication.GetWindow();
+    window.SetBackgroundColor(Color::WHITE);
+
+    mTextLabel = TextLabel::New("Startup latency");
+    mTextLabel.SetProperty(Actor::Property::PARENT_ORIGIN,
+                           ParentOrigin::TOP_LEFT);
+    mTextLabel.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+    mTextLabel.ResourceReadySignal().Connect(this,
+                                             &StartupLatencyTest::OnReady);
+    window.Add(mTextLabel);
+
+    mImageView = ImageView::New(IMAGE_FILE);
+    mImageView.SetProperty(Actor::Property::PARENT_ORIGIN,
+                           ParentOrigin::CENTER);
+    mImageView.SetProperty(Actor::Property::PIVOT, Pivot::CENTER);
+    mImageView.ResourceReadySignal().Connect(this,
+                                             &StartupLatencyTest::OnReady);
+    window.Add(mImageView);
+
+    // The first frame is presented after the update which renders the controls
+    mSequencer.AddStep("launch")
+        .WaitForResourceReady(mTextLabel)
+        .WaitForResourceReady(mImageView)
+        .WaitForFrames(2)
+        .MaxWait(LAUNCH_MAX_WAIT)
+        .Then([this]() { ReportLaunch(); });
+    if (!mWarmLaunch) {
+      mSequencer.AddStep("warm-launch")
+          .Do([this]() { LaunchWarm(); })
+          .WaitUntil([this]() { return HasWarmLaunchExited(); })
+          .MaxWait(WARM_LAUNCH_MAX_WAIT)
+          .Then([this]() { ReportWarm(); });
+    }
+    mSequencer.SetFinishedCallback([this]() { Finish(mApplication); });
+    mSequencer.Start(window);
+  }
+
+private:
+  void OnReady(Control control) {
+    if (mTextLabel.IsResourceReady() && mImageView.IsResourceReady()) {
+      MarkStartupPhase(STARTUP_CONTROL_READY);
+    }
+  }
+
+  /**
+   * @brief Report the phases of this launch, or write them for the cold
+   * launch if this is the warm one.
+   */
+  void ReportLaunch() {
+    std::ofstream report;
+    if (mWarmLaunch) {
+      report.open(getenv(STARTUP_REPORT_ENV));
+    }
+
+    for (StartupPhase phase : REPORTED_PHASES) {
+      const double milliseconds = GetStartupPhaseMs(phase);
+      if (milliseconds < 0.0) {
+        FailStep(std::string(GetStartupPhaseName(phase)) +
+                 " has not been reached");
+      }
+      if (mWarmLaunch) {
+        report << GetStartupPhaseName(phase) << " " << milliseconds << "\n";
+      } else {
+        ReportMetric(std::string("cold.") + GetStartupPhaseName(phase),
+                     milliseconds, "ms");
+      }
+    }
+  }
+
+  /**
+   * @brief Launch the test again with the same options, without waiting for
+   * it: the event thread keeps running while the warm launch starts.
+   */
+  void LaunchWarm() {
+    char reportFile[] = "/tmp/dali-startup.XXXXXX";
+    const int descriptor = mkstemp(reportFile);
+    if (descriptor < 0) {
+      FailStep("the report of the warm launch cannot be created");
+      return;
+    }
+    close(descriptor);
+    mReportFile = reportFile;
+
+    std::vector<std::string> variables;
+    for (char **variable = environ; *variable; ++variable) {
+      variables.push_back(*variable);
+    }
+    variables.push_back(std::string(STARTUP_REPORT_ENV) + "=" + mReportFile);
+    variables.push_back(std::string(STARTUP_EXEC_TIME_ENV) + "=");
+    const size_t execTimeIndex = variables.size() - 1u;
+
+    // The same executable, with its own name rather than /proc/self/exe, and
+    // the options of this launch but its outputs
+    const std::string executable =
+        std::filesystem::read_symlink("/proc/self/exe").string();
+    std::vector<char *> arguments;
+    arguments.push_back(const_cast<char *>(executable.c_str()));
+    for (const std::string &argument : GetChildRunArguments()) {
+      arguments.push_back(const_cast<char *>(argument.c_str()));
+    }
+    arguments.push_back(nullptr);
+
+    // posix_spawn does not copy the memory of this process, so the launch
+    // starts right after this time
+    variables[execTimeIndex] += std::to_string(GetStartupClockNs());
+    std::vector<char *> environment;
+    for (auto &variable : variables) {
+      environment.push_back(const_cast<char *>(variable.c_str()));
+    }
+    environment.push_back(nullptr);
+
+    if (posix_spawn(&mWarmChild, executable.c_str(), nullptr, nullptr,
+                    arguments.data(), environment.data()) != 0) {
+      mWarmChild = 0;
+      FailStep("the warm launch cannot be started");
+      return;
+    }
+    mWarmLaunched = true;
+  }
+
+  /**
+   * @brief Check without blocking whether the warm launch has exited.
+   */
+  bool HasWarmLaunchExited() {
+    if (mWarmChild != 0 &&
+        waitpid(mWarmChild, &mWarmStatus, WNOHANG) == mWarmChild) {
+      mWarmChild = 0;
+    }
+    return mWarmChild == 0;
+  }
+
+  /**
+   * @brief Report the phases of the warm launch, once it has exited or the
+   * step has given up waiting for it.
+   */
+  void ReportWarm() {
+    if (mWarmChild != 0) {
+      // The step has given up waiting, which has failed it
+      kill(mWarmChild, SIGKILL);
+      waitpid(mWarmChild, nullptr, 0);
+      mWarmChild = 0;
+    } else if (mWarmLaunched &&
+               (!WIFEXITED(mWarmStatus) || WEXITSTATUS(mWarmStatus) != 0)) {
+      FailStep("the warm launch has failed");
+    }
+
+    if (mReportFile.empty()) {
+      return;
+    }
+    std::ifstream report(mReportFile);
+    std::string name;
+    double milliseconds = 0.0;
+    int phases = 0;
+    while (report >> name >> milliseconds) {
+      ReportMetric("warm." + name, milliseconds, "ms");
+      ++phases;
+    }
+    if (phases != static_cast<int>(std::size(REPORTED_PHASES))) {
+      FailStep("the warm launch has not reported every phase");
+    }
+    unlink(mReportFile.c_str());
+  }
+
+private:
+  Application &mApplication;
+  StepSequencer mSequencer;
+  TextLabel mTextLabel;
+  ImageView mImageView;
+  bool mWarmLaunch;
+  pid_t mWarmChild = 0; ///< The warm launch until it has exited
+  int mWarmStatus = 0;  ///< The exit status of the warm launch
+  bool mWarmLaunched = false;
+  std::string mReportFile; ///< The phases written by the warm launch
+};
+
+DALI_BENCHMARK_TEST(StartupLatencyTest, OnInit, 480, 800, 2,
+                    DEFAULT_STEP_TIMEOUT)
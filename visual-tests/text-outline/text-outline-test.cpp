@@ -33,20 +33,11 @@ using namespace Dali::Toolkit;
 namespace
 {
 
-const std::string IMAGE_FILE_1 = TEST_IMAGE_DIR "text-outline/expected-result-1.png";
-const std::string IMAGE_FILE_2 = TEST_IMAGE_DIR "text-outline/expected-result-2.png";
+const std::string IMAGE_FILE_1 = TestImagePath("text-outline/expected-result-1.png");
+const std::string IMAGE_FILE_2 = TestImagePath("text-outline/expected-result-2.png");
 
 const int NUMBER_OF_TEXT_LABELS = 6;
 
-enum TestStep
-{
-  ENGLISH_OUTLINE,
-  MULTI_LANGUAGE_OUTLINE,
-  NUMBER_OF_STEPS
-};
-
-static int gTestStep = -1;
-
 }  // namespace
 
 /**
@@ -59,7 +50,8 @@ class TextOutlineTest: public VisualTest
  public:
 
   TextOutlineTest( Application& application )
-    : mApplication( application )
+    : mApplication( application ),
+      mSequencer( *this )
   {
     setenv("DALI_MATCH_SYSTEM_LANGUAGE_DIRECTION", "0", true);
   }
@@ -87,34 +79,15 @@ class TextOutlineTest: public VisualTest
       window.Add( mTextLabel[i] );
     }
 
-    PerformNextTest();
+    mSequencer.AddStep( "english-outline" ).Do( [this]() { EnglishOutlineTest(); } ).Capture();
+    mSequencer.AddStep( "multi-language-outline" ).Do( [this]() { MultiLanguageOutlineTest(); } ).Capture();
+
+    mSequencer.SetFinishedCallback( [this]() { mApplication.Quit(); } );
+    mSequencer.Start( window );
   }
 
 private:
 
-  void PerformNextTest()
-  {
-    gTestStep++;
-
-    switch ( gTestStep )
-    {
-      case ENGLISH_OUTLINE:
-      {
-        EnglishOutlineTest();
-        CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-        break;
-      }
-      case MULTI_LANGUAGE_OUTLINE:
-      {
-        MultiLanguageOutlineTest();
-        CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-        break;
-      }
-      default:
-        break;
-    }
-  }
-
   void EnglishOutlineTest()
   {
     mTextLabel[0].SetProperty( TextLabel::Property::TEXT, "uVWXYZ" );
@@ -175,20 +148,17 @@ private:
     std::string images[] = {IMAGE_FILE_1, IMAGE_FILE_2};
 
     // All steps will have same result.
-    CompareImageFile(images[gTestStep], outputFile, 0.98f);
-
-    if( gTestStep < MULTI_LANGUAGE_OUTLINE )
-    {
-      PerformNextTest();
-    }
-    else
-    {
-      mApplication.Quit();
+    if (!CompareImageFile(images[mSequencer.GetCurrentStep()], outputFile, 0.98f) &&
+        RetryCapture()) {
+      return;
     }
+
+    mSequencer.Next();
   }
 
 private:
   Application&            mApplication;
+  StepSequencer           mSequencer;
   TextLabel               mTextLabel[6];
 };
 
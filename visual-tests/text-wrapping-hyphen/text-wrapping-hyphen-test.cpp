@@ -33,23 +33,13 @@ using namespace Dali::Toolkit;
 namespace {
 
 const std::string IMAGE_FILE_HYPHEN =
-    TEST_IMAGE_DIR "text-wrapping-hyphen/hyphen-expected-result.png";
+    TestImagePath("text-wrapping-hyphen/hyphen-expected-result.png");
 const std::string IMAGE_FILE_MIXED =
-    TEST_IMAGE_DIR "text-wrapping-hyphen/mixed-expected-result.png";
+    TestImagePath("text-wrapping-hyphen/mixed-expected-result.png");
 const std::string IMAGE_FILE_HYPHEN_EDITOR =
-    TEST_IMAGE_DIR "text-wrapping-hyphen/hyphen-editor-expected-result.png";
+    TestImagePath("text-wrapping-hyphen/hyphen-editor-expected-result.png");
 const std::string IMAGE_FILE_MIXED_EDITOR =
-    TEST_IMAGE_DIR "text-wrapping-hyphen/mixed-editor-expected-result.png";
-
-enum TestStep {
-  HYPHEN_WRAPPING_LABEL,
-  MIXED_WRAPPING_LABEL,
-  HYPHEN_WRAPPING_EDITOR,
-  MIXED_WRAPPING_EDITOR,
-  NUMBER_OF_STEPS
-};
-
-static int gTestStep = -1;
+    TestImagePath("text-wrapping-hyphen/mixed-editor-expected-result.png");
 
 } // namespace
 
@@ -59,7 +49,8 @@ static int gTestStep = -1;
  */
 class TextWrappingTest : public VisualTest {
 public:
-  TextWrappingTest(Application &application) : mApplication(application) {}
+  TextWrappingTest(Application &application)
+      : mApplication(application), mSequencer(*this) {}
 
   void OnInit(Application application) {
     mWindow = mApplication.GetWindow();
@@ -92,43 +83,29 @@ public:
     mTextEditor.SetProperty(DevelTextEditor::Property::REMOVE_BACK_INSET, true);
 
     mWindow.Add(mTextLabel);
-    PerformNextTest();
+
+    mSequencer.AddStep("hyphen-label")
+        .Do([this]() { HyphenWrappingTestLabel(); })
+        .Capture();
+    mSequencer.AddStep("mixed-label")
+        .Do([this]() { MixedWrappingTestLabel(); })
+        .Capture();
+    mSequencer.AddStep("hyphen-editor")
+        .Do([this]() {
+          mWindow.Remove(mTextLabel);
+          mWindow.Add(mTextEditor);
+          HyphenWrappingTestEditor();
+        })
+        .Capture();
+    mSequencer.AddStep("mixed-editor")
+        .Do([this]() { MixedWrappingTestEditor(); })
+        .Capture();
+
+    mSequencer.SetFinishedCallback([this]() { mApplication.Quit(); });
+    mSequencer.Start(mWindow);
   }
 
 private:
-  void PerformNextTest()
-  {
-    gTestStep++;
-
-    switch (gTestStep)
-    {
-    case HYPHEN_WRAPPING_LABEL:
-    {
-      HyphenWrappingTestLabel();
-      break;
-    }
-    case MIXED_WRAPPING_LABEL:
-    {
-      MixedWrappingTestLabel();
-      break;
-    }
-    case HYPHEN_WRAPPING_EDITOR:
-    {
-      mWindow.Remove(mTextLabel);
-      mWindow.Add(mTextEditor);
-      HyphenWrappingTestEditor();
-      break;
-    }
-    case MIXED_WRAPPING_EDITOR:
-    {
-      MixedWrappingTestEditor();
-      break;
-    }
-    default:
-      break;
-    }
-    CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-  }
 
 
   void HyphenWrappingTestLabel()
@@ -162,19 +139,16 @@ private:
   void PostRender(std::string outputFile, bool success)
   {
     const std::string images[] = {IMAGE_FILE_HYPHEN ,IMAGE_FILE_MIXED ,IMAGE_FILE_HYPHEN_EDITOR ,IMAGE_FILE_MIXED_EDITOR};
-    CompareImageFile(images[gTestStep], outputFile, 0.95f);
-    if(gTestStep < NUMBER_OF_STEPS-1)
-    {
-      PerformNextTest();
-    }
-    else
+    if(!CompareImageFile(images[mSequencer.GetCurrentStep()], outputFile, 0.95f) && RetryCapture())
     {
-      mApplication.Quit();
+      return;
     }
+    mSequencer.Next();
   }
 
 private:
   Application &mApplication;
+  StepSequencer mSequencer;
   Dali::Window mWindow;
   TextLabel mTextLabel;
   TextEditor mTextEditor;
@@ -32,32 +32,18 @@ using Dali::Integration::ToDaliStringView;
 
 namespace {
 
-const unsigned int DEFAULT_DELAY_TIME = 200;
-
-const char *const ICON_IMAGE(TEST_IMAGE_DIR "transform-update/circle.png");
+const std::string ICON_IMAGE(TestImagePath("transform-update/circle.png"));
 
 const std::string FIRST_IMAGE_FILE =
-    TEST_IMAGE_DIR "transform-update/expected-result-1.png";
+    TestImagePath("transform-update/expected-result-1.png");
 const std::string SECOND_IMAGE_FILE =
-    TEST_IMAGE_DIR "transform-update/expected-result-2.png";
+    TestImagePath("transform-update/expected-result-2.png");
 const std::string THIRD_IMAGE_FILE =
-    TEST_IMAGE_DIR "transform-update/expected-result-3.png";
+    TestImagePath("transform-update/expected-result-3.png");
 
 const int WINDOW_WIDTH(480);
 const int WINDOW_HEIGHT(800);
 
-enum TestStep {
-  PRE_ANIMATION,
-  START_ANIMATION,
-  PAUSE_ANIMATION,
-  CAPTURE_MID_ANIMATION,
-  RESUME_ANIMATION,
-  POST_ANIMATION,
-  NUMBER_OF_STEPS
-};
-
-static int gTestStep = -1;
-
 void AnimatingPositionConstraint(Vector3 &current,
                                  const PropertyInputContainer &inputs) {
   float positionFactor(inputs[0]->GetFloat());
@@ -74,8 +60,8 @@ void AnimatingPositionConstraint(Vector3 &current,
 class TransformUpdateTest : public VisualTest {
 public:
   TransformUpdateTest(Application &application)
-      : mApplication(application), mAnimIcon(), mLayer(), mAnimation(),
-        mPositionFactorIndex() {}
+      : mApplication(application), mSequencer(*this), mAnimIcon(), mLayer(),
+        mAnimation(), mPositionFactorIndex() {}
 
   void OnInit(Application application) {
     Window window = mApplication.GetWindow();
@@ -106,99 +92,47 @@ public:
     mAnimation.AnimateTo(Property(mAnimIcon, mPositionFactorIndex), 0.8f,
                          AlphaFunction(point1, point2));
 
+    // Half of the animation, in the time of the clock of the sequencer which
+    // does not wait in real time with --virtual-clock
+    const unsigned int delay = mAnimation.GetDuration() * 500;
+
+    mSequencer.AddStep("pre-animation")
+        .WaitForResourceReady(mAnimIcon)
+        .Capture();
+    mSequencer.AddStep("play-to-middle")
+        .Do([this]() { mSequencer.GetClock().Play(mAnimation); })
+        .WaitForTime(delay);
+    mSequencer.AddStep("mid-animation")
+        .Do([this]() { mSequencer.GetClock().Pause(mAnimation); })
+        .WaitForFrames(1)
+        .Capture();
+    mSequencer.AddStep("post-animation")
+        .Do([this]() { mSequencer.GetClock().Play(mAnimation); })
+        .WaitForTime(delay)
+        .WaitForAnimation(mAnimation)
+        .Capture();
+    mSequencer.SetFinishedCallback([this]() { mApplication.Quit(); });
+
     // Start the test
-    PrepareNextTest(DEFAULT_DELAY_TIME);
+    mSequencer.Start(window);
   }
 
 private:
-  void PrepareNextTest(unsigned int milliSecond) {
-    gTestStep++;
-
-    if (milliSecond == 0u) {
-      PerformTest();
-    } else {
-      mTimer = Timer::New(milliSecond);
-      mTimer.TickSignal().Connect(this, &TransformUpdateTest::OnTimer);
-      mTimer.Start();
-    }
-  }
-
-  bool OnTimer() {
-    PerformTest();
-    return false;
-  }
-
-  void PerformTest() {
-    Window window = mApplication.GetWindow();
-
-    unsigned int delay = 0u;
-    if (mAnimation) {
-      delay = mAnimation.GetDuration() * 500;
-    }
-
-    switch (gTestStep) {
-    case PRE_ANIMATION: {
-      CaptureWindowAfterFrameRendered(window);
-      break;
-    }
-    case START_ANIMATION: {
-      if (mAnimation) {
-        mAnimation.Play();
-      }
-
-      PrepareNextTest(delay); // play until half of the animation
-
-      break;
-    }
-    case PAUSE_ANIMATION: {
-      if (mAnimation) {
-        mAnimation.Pause();
-      }
-
-      PrepareNextTest(DEFAULT_DELAY_TIME);
-
-      break;
-    }
-    case CAPTURE_MID_ANIMATION: {
-      CaptureWindowAfterFrameRendered(window);
-      break;
-    }
-    case RESUME_ANIMATION: {
-      if (mAnimation) {
-        mAnimation.Play();
-      }
-
-      PrepareNextTest(delay + DEFAULT_DELAY_TIME);
-
-      break;
-    }
-    case POST_ANIMATION: {
-      CaptureWindowAfterFrameRendered(window);
-      break;
-    }
-    default:
-      break;
-    }
-  }
-
   void PostRender(std::string outputImage, bool success) {
-    if (gTestStep == PRE_ANIMATION) {
-      CompareImageFile(FIRST_IMAGE_FILE, outputImage, 0.99f);
-      PrepareNextTest(DEFAULT_DELAY_TIME);
-    } else if (gTestStep == CAPTURE_MID_ANIMATION) {
-      CompareImageFile(SECOND_IMAGE_FILE, outputImage, 0.99f);
-      PrepareNextTest(DEFAULT_DELAY_TIME);
-    } else if (gTestStep == POST_ANIMATION) {
-      CompareImageFile(THIRD_IMAGE_FILE, outputImage, 0.99f);
-
-      // The last check has been done, so we can quit the test
-      mApplication.Quit();
+    const std::string images[] = {FIRST_IMAGE_FILE, "", SECOND_IMAGE_FILE,
+                                  THIRD_IMAGE_FILE};
+
+    if (!CompareImageFile(images[mSequencer.GetCurrentStep()], outputImage,
+                          0.99f) &&
+        RetryCapture()) {
+      return;
     }
+    mSequencer.Next();
   }
 
 private:
   Application &mApplication;
-  Timer mTimer;
+  StepSequencer mSequencer;
   ImageView mAnimIcon;
   Layer mLayer;
   Animation mAnimation;
@@ -32,15 +32,11 @@ using namespace Dali::Toolkit;
 using Dali::Integration::ToDaliStringView;
 
 namespace {
-const std::string ICON_FILE = TEST_IMAGE_DIR "window-resize/circle.png";
+const std::string ICON_FILE = TestImagePath("window-resize/circle.png");
 const std::string FIRST_IMAGE_FILE =
-    TEST_IMAGE_DIR "window-resize/expected-result-1.png";
+    TestImagePath("window-resize/expected-result-1.png");
 const std::string SECOND_IMAGE_FILE =
-    TEST_IMAGE_DIR "window-resize/expected-result-2.png";
-
-enum TestStep { FULL_WINDOW_CAPTURE, PARTIAL_WINDOW_CAPTURE, NUMBER_OF_STEPS };
-
-static int gTestStep = -1;
+    TestImagePath("window-resize/expected-result-2.png");
 
 } // namespace
 
@@ -51,7 +47,8 @@ static int gTestStep = -1;
  */
 class WindowResizeTest : public VisualTest {
 public:
-  WindowResizeTest(Application &application) : mApplication(application) {}
+  WindowResizeTest(Application &application)
+      : mApplication(application), mSequencer(*this) {}
 
   void OnInit(Application application) {
     Window window = mApplication.GetWindow();
@@ -61,35 +58,35 @@ public:
     mActor.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
     window.Add(mActor);
 
-    // Start the test
-    PrepareNextTest();
+    mSequencer.AddStep("full-window").Capture();
+    mSequencer.AddStep("partial-window")
+        .Do([this]() {
+          // Resize the window
+          Window window = mApplication.GetWindow();
+          Window::WindowSize WINDOW_SIZE(300, 600);
+          window.SetSize(WINDOW_SIZE);
+        })
+        .Capture();
+
+    mSequencer.SetFinishedCallback([this]() { mApplication.Quit(); });
+    mSequencer.Start(window);
   }
 
 private:
-  void PrepareNextTest() {
-    gTestStep++;
-    if (gTestStep == PARTIAL_WINDOW_CAPTURE) {
-      // Resize the window
-      Window window = mApplication.GetWindow();
-      Window::WindowSize WINDOW_SIZE(300, 600);
-      window.SetSize(WINDOW_SIZE);
-    }
-    CaptureWindowAfterFrameRendered(mApplication.GetWindow());
-  }
-
   void PostRender(std::string outputFile, bool success) {
     std::string images[] = {FIRST_IMAGE_FILE, SECOND_IMAGE_FILE};
 
-    CompareImageFile(images[gTestStep], outputFile, 0.98f);
-    if (gTestStep + 1u == NUMBER_OF_STEPS) {
-      mApplication.Quit();
-    } else {
-      PrepareNextTest();
+    if (!CompareImageFile(images[mSequencer.GetCurrentStep()], outputFile,
+                          0.98f) &&
+        RetryCapture()) {
+      return;
     }
+    mSequencer.Next();
   }
 
 private:
   Application &mApplication;
+  StepSequencer mSequencer;
   Actor mActor;
 };
 